@@ -1,12 +1,12 @@
 import sys
 import os
-import subprocess
 import traceback
 import time
 from absl import app
 from absl import logging
 import google.generativeai as genai
 from dotenv import load_dotenv
+import executor
 
 # Load environment variables from .env file
 load_dotenv()
@@ -34,25 +34,44 @@ def read_file(filename):
         return None
 
 
-def run_cpp_program(cpp_filename):
-    """Compile and run a C++ program, returning its output."""
+# The analyzer is our own program, so it gets more memory than a user snippet: it keeps
+# about 30 bytes per input byte, which the default 1 GB job limit runs out of near 24 MB
+ANALYZER_MEMORY_MB = int(os.getenv("ANALYZER_MEMORY_MB", "4096"))
+ANALYZER_BYTES_PER_INPUT_BYTE = 64
+# Time left between the analysis budget and the job's CPU limit for printing the report
+ANALYSIS_MARGIN_MS = 2000
+
+
+def analysis_budget_ms():
+    """ANALYSIS_BUDGET_MS, capped so the analyzer stops on its budget and prints partial
+    results before the job's CPU limit kills it with no output."""
+    requested = int(os.getenv("ANALYSIS_BUDGET_MS", "20000"))
+    return max(1, min(requested, executor.CPU_SECONDS * 1000 - ANALYSIS_MARGIN_MS))
+
+
+def run_cpp_program(cpp_filename, args=(), memory_mb=None):
+    """Compile (or reuse the cached build of) a C++ program and run it, returning its output."""
     try:
-        exe_file = os.path.splitext(cpp_filename)[0] + ".exe"
-        compile_cmd = ["g++", cpp_filename, "-o", exe_file]
-        compile_process = subprocess.run(compile_cmd, capture_output=True, text=True)
+        source = read_file(cpp_filename)
+        if source is None:
+            return f"Cannot read {cpp_filename}"
 
-        if compile_process.returncode != 0:
+        limits = {"memory_bytes": memory_mb * 1024 * 1024} if memory_mb else {}
+        result = executor.run_cpp(source, args=args, cwd=os.getcwd(), **limits)
+        if result.stage == "compile":
             logging.error(f"Compilation error in {cpp_filename}:")
-            logging.error(compile_process.stderr)
+            logging.error(result.stderr)
             return f"Compilation failed for {cpp_filename}"
 
-        run_process = subprocess.run([exe_file], capture_output=True, text=True)
-        if run_process.returncode != 0:
+        if result.returncode != 0:
             logging.error(f"Runtime error in {cpp_filename}:")
-            logging.error(run_process.stderr)
+            logging.error(result.stderr)
+            if result.stdout.strip():
+                # Stopped by a limit while printing; what it printed is still a report
+                return f"{result.stdout.strip()}\n(Output cut short: {result.stderr.strip() or 'killed'})"
             return f"Runtime error in {cpp_filename}"
 
-        return run_process.stdout.strip()
+        return result.stdout.strip()
 
     except Exception as e:
         logging.error(f"Error executing {cpp_filename}: {e}")
@@ -97,7 +116,13 @@ def main(argv):
 
         # Run merged.cpp output
         logging.info("Running merged.cpp...")
-        cpp_output = run_cpp_program("merged.cpp")
+        input_bytes = len(lexical_input.encode("utf-8", "surrogateescape"))
+        if input_bytes * ANALYZER_BYTES_PER_INPUT_BYTE > ANALYZER_MEMORY_MB * 1024 * 1024:
+            cpp_output = (f"Input too large to analyze ({input_bytes / 1048576:.1f} MB; "
+                          f"the limit is {ANALYZER_MEMORY_MB / ANALYZER_BYTES_PER_INPUT_BYTE:.0f} MB)")
+        else:
+            cpp_output = run_cpp_program("merged.cpp", args=["--budget-ms", str(analysis_budget_ms())],
+                                         memory_mb=ANALYZER_MEMORY_MB)
         print(cpp_output)
 
         # Prepare Gemini input
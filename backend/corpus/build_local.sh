@@ -0,0 +1,71 @@
+#!/bin/sh
+# Builds a detection corpus from sources installed on this machine:
+#   corpus/build_local.sh <out dir>
+# writes <out>/test/<Language>/, a held-out set for --bench-detect, and <out>/train/<Language>/
+# for experiments with --train-trigram. The committed trigram_model.h is trained on
+# corpus/train only, since this output depends on what the machine has installed. Every
+# fifth file (in a fixed shuffled order) goes to the test side, cut into SNIPPET_LINES-line
+# snippets; training files are cut to TRAIN_FILE_BYTES (so a few huge generated files cannot
+# dominate) and taken until TRAIN_BYTES per language. The hand-written files of corpus/train
+# are added to the training side as well.
+#
+# C++:    googletest/googlemock, Boost headers, Catch2 and spdlog examples
+# Python: the CPython standard library of the python3 on PATH
+# Java:   protoc --java_out over the protobuf well-known types, bison -L java over its
+#         examples, and the protobuf Java examples (the only Java shipped with the system)
+set -e
+out=${1:?usage: build_local.sh <out dir>}
+TRAIN_BYTES=${TRAIN_BYTES:-4000000}
+TRAIN_FILE_BYTES=${TRAIN_FILE_BYTES:-32768}
+TEST_FILES=${TEST_FILES:-400}
+SNIPPET_LINES=${SNIPPET_LINES:-60}
+
+rm -rf "$out"
+mkdir -p "$out/generated"
+work=$(cd "$out/generated" && pwd)
+
+# Java sources have to be generated first
+if command -v protoc >/dev/null; then
+    (cd /usr/include && protoc --java_out="$work" google/protobuf/*.proto)
+fi
+if command -v bison >/dev/null; then
+    for example in /usr/share/doc/bison/examples/java/*/Calc.y; do
+        name=$(basename "$(dirname "$example")")
+        mkdir -p "$work/bison/$name"
+        bison -L java -o "$work/bison/$name/Calc.java" "$example" 2>/dev/null || true
+    done
+fi
+
+corpus=$(cd "$(dirname "$0")" && pwd)
+stdlib=$(python3 -c 'import sysconfig; print(sysconfig.get_paths()["stdlib"])')
+
+list() {
+    case $1 in
+    C++) find /usr/src/googletest /usr/include/boost /usr/share/doc/catch2/examples \
+             /usr/share/doc/libspdlog-dev/tests \( -name '*.cc' -o -name '*.cpp' -o -name '*.hpp' \
+             -o -name '*.h' \) 2>/dev/null ;;
+    Python) find "$stdlib" -path '*/site-packages' -prune -o -name '*.py' -print ;;
+    Java) find "$work" /usr/share/doc/protobuf-compiler/examples -name '*.java' 2>/dev/null ;;
+    esac | shuf --random-source=/dev/zero
+}
+
+for language in C++ Java Python; do
+    mkdir -p "$out/train/$language" "$out/test/$language"
+    cp "$corpus/train/$language"/* "$out/train/$language/"
+    n=0 trained=0 tested=0
+    for file in $(list $language); do
+        [ -s "$file" ] || continue
+        n=$((n + 1))
+        ext=${file##*.}
+        if [ $((n % 5)) -eq 0 ]; then
+            [ $tested -lt "$TEST_FILES" ] || continue
+            tested=$((tested + 1))
+            split -l "$SNIPPET_LINES" -d -a 4 --additional-suffix=".$ext" "$file" "$out/test/$language/$n-"
+        elif [ $trained -lt "$TRAIN_BYTES" ]; then
+            head -c "$TRAIN_FILE_BYTES" "$file" >"$out/train/$language/$n.$ext"
+            trained=$((trained + $(wc -c <"$out/train/$language/$n.$ext")))
+        fi
+    done
+    echo "$language: $(ls "$out/train/$language" | wc -l) training files ($trained bytes)," \
+         "$(ls "$out/test/$language" | wc -l) test snippets"
+done
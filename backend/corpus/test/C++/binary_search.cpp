@@ -0,0 +1,11 @@
+#include <vector>
+
+int lowerBound(const std::vector<int>& a, int key) {
+    int lo = 0, hi = (int)a.size();
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (a[mid] < key) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
@@ -0,0 +1,9 @@
+class Counter {
+    std::map<std::string, int> counts_;
+public:
+    void add(const std::string& word) { ++counts_[word]; }
+    int get(const std::string& word) const {
+        auto it = counts_.find(word);
+        return it == counts_.end() ? 0 : it->second;
+    }
+};
@@ -0,0 +1,4 @@
+struct Point {
+    double x, y;
+    Point operator+(const Point& o) const { return {x + o.x, y + o.y}; }
+};
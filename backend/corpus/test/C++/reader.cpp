@@ -0,0 +1,10 @@
+#include <fstream>
+#include <string>
+
+size_t countLines(const char* path) {
+    std::ifstream in(path);
+    std::string line;
+    size_t n = 0;
+    while (std::getline(in, line)) ++n;
+    return n;
+}
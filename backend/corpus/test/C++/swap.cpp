@@ -0,0 +1,6 @@
+template <class T>
+void swap_values(T& a, T& b) {
+    T tmp = std::move(a);
+    a = std::move(b);
+    b = std::move(tmp);
+}
@@ -0,0 +1,14 @@
+import java.util.HashMap;
+import java.util.Map;
+
+final class Counter {
+    private final Map<String, Integer> counts = new HashMap<>();
+
+    void add(String word) {
+        counts.merge(word, 1, Integer::sum);
+    }
+
+    int get(String word) {
+        return counts.getOrDefault(word, 0);
+    }
+}
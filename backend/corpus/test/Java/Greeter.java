@@ -0,0 +1,11 @@
+class Greeter {
+    private final String greeting;
+
+    Greeter(String greeting) {
+        this.greeting = greeting;
+    }
+
+    String greet(String name) {
+        return greeting + ", " + name + "!";
+    }
+}
@@ -0,0 +1,5 @@
+static long countLines(Path path) throws IOException {
+    try (Stream<String> lines = Files.lines(path)) {
+        return lines.count();
+    }
+}
@@ -0,0 +1,5 @@
+public record Point(double x, double y) {
+    public Point plus(Point other) {
+        return new Point(x + other.x(), y + other.y());
+    }
+}
@@ -0,0 +1,9 @@
+static int lowerBound(int[] a, int key) {
+    int lo = 0, hi = a.length;
+    while (lo < hi) {
+        int mid = (lo + hi) >>> 1;
+        if (a[mid] < key) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
@@ -0,0 +1,7 @@
+int sum(int[] values) {
+    int total = 0;
+    for (int v : values) {
+        total += v;
+    }
+    return total;
+}
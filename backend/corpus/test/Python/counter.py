@@ -0,0 +1,5 @@
+from collections import Counter
+
+words = open("input.txt").read().split()
+for word, count in Counter(words).most_common(5):
+    print(f"{word}: {count}")
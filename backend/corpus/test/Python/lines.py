@@ -0,0 +1,7 @@
+import sys
+
+n = 0
+for line in sys.stdin:
+    if line.strip():
+        n += 1
+print(n)
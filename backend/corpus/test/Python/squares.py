@@ -0,0 +1,3 @@
+squares = [x * x for x in range(10) if x % 2 == 0]
+lookup = {name: len(name) for name in ["alpha", "beta"]}
+print(squares, lookup)
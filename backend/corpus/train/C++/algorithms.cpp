@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+namespace algo {
+
+int maxElement(const std::vector<int>& values) {
+    if (values.empty()) throw std::invalid_argument("empty vector");
+    return *std::max_element(values.begin(), values.end());
+}
+
+long long sum(const std::vector<int>& values) {
+    return std::accumulate(values.begin(), values.end(), 0LL);
+}
+
+int binarySearch(const std::vector<int>& sorted, int key) {
+    int low = 0, high = static_cast<int>(sorted.size()) - 1;
+    while (low <= high) {
+        int mid = low + (high - low) / 2;
+        if (sorted[mid] < key) low = mid + 1;
+        else if (sorted[mid] > key) high = mid - 1;
+        else return mid;
+    }
+    return -1;
+}
+
+void insertionSort(std::vector<int>& a) {
+    for (size_t i = 1; i < a.size(); ++i) {
+        int key = a[i];
+        size_t j = i;
+        while (j > 0 && a[j - 1] > key) {
+            a[j] = a[j - 1];
+            --j;
+        }
+        a[j] = key;
+    }
+}
+
+std::vector<int> prefixSums(const std::vector<int>& values) {
+    std::vector<int> sums(values.size() + 1, 0);
+    std::partial_sum(values.begin(), values.end(), sums.begin() + 1);
+    return sums;
+}
+
+} // namespace algo
+
+int main() {
+    std::vector<int> data{5, 3, 9, 1, 7};
+    algo::insertionSort(data);
+    for (int v : data) std::cout << v << ' ';
+    std::cout << "\nmax = " << algo::maxElement(data) << ", sum = " << algo::sum(data) << '\n';
+    std::cout << "index of 7: " << algo::binarySearch(data, 7) << std::endl;
+    return 0;
+}
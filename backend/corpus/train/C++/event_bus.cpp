@@ -0,0 +1,47 @@
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+struct Event {
+    virtual ~Event() = default;
+    virtual std::string name() const = 0;
+};
+
+class EventBus {
+public:
+    using Handler = std::function<void(const Event&)>;
+
+    template <typename T>
+    void subscribe(std::function<void(const T&)> handler) {
+        handlers_[std::type_index(typeid(T))].push_back(
+            [handler](const Event& e) { handler(static_cast<const T&>(e)); });
+    }
+
+    int publish(const Event& event) {
+        auto it = handlers_.find(std::type_index(typeid(event)));
+        if (it == handlers_.end()) return 0;
+        for (auto& handler : it->second) handler(event);
+        return static_cast<int>(it->second.size());
+    }
+
+private:
+    std::map<std::type_index, std::vector<Handler>> handlers_;
+};
+
+struct UserCreated : Event {
+    explicit UserCreated(std::string u) : user(std::move(u)) {}
+    std::string name() const override { return "user-created"; }
+    std::string user;
+};
+
+int main() {
+    EventBus bus;
+    bus.subscribe<UserCreated>([](const UserCreated& e) { std::cout << "welcome " << e.user << '\n'; });
+    auto event = std::make_unique<UserCreated>("ada");
+    std::cout << bus.publish(*event) << " handlers\n";
+    return 0;
+}
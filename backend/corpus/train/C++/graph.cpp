@@ -0,0 +1,78 @@
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <limits>
+#include <algorithm>
+
+using namespace std;
+
+// Weighted directed graph stored as adjacency lists
+class Graph {
+    int vertices;
+    vector<vector<pair<int, int>>> adjacency;
+
+public:
+    explicit Graph(int n) : vertices(n), adjacency(n) {}
+
+    void addEdge(int from, int to, int weight) {
+        adjacency[from].push_back({to, weight});
+    }
+
+    // Dijkstra's shortest paths from a single source
+    vector<long long> shortestPaths(int source) const {
+        const long long INF = numeric_limits<long long>::max();
+        vector<long long> dist(vertices, INF);
+        priority_queue<pair<long long, int>, vector<pair<long long, int>>, greater<>> pq;
+        dist[source] = 0;
+        pq.push({0, source});
+
+        while (!pq.empty()) {
+            auto [d, u] = pq.top();
+            pq.pop();
+            if (d > dist[u]) continue;
+            for (const auto& [v, w] : adjacency[u]) {
+                if (dist[u] + w < dist[v]) {
+                    dist[v] = dist[u] + w;
+                    pq.push({dist[v], v});
+                }
+            }
+        }
+        return dist;
+    }
+
+    bool hasCycle() const {
+        vector<int> state(vertices, 0);
+        for (int i = 0; i < vertices; ++i) {
+            if (state[i] == 0 && visit(i, state)) return true;
+        }
+        return false;
+    }
+
+private:
+    bool visit(int u, vector<int>& state) const {
+        state[u] = 1;
+        for (const auto& edge : adjacency[u]) {
+            if (state[edge.first] == 1) return true;
+            if (state[edge.first] == 0 && visit(edge.first, state)) return true;
+        }
+        state[u] = 2;
+        return false;
+    }
+};
+
+int main() {
+    int n, m;
+    cin >> n >> m;
+    Graph g(n);
+    for (int i = 0; i < m; ++i) {
+        int a, b, w;
+        cin >> a >> b >> w;
+        g.addEdge(a, b, w);
+    }
+    auto dist = g.shortestPaths(0);
+    for (int i = 0; i < n; ++i) {
+        cout << i << ": " << dist[i] << '\n';
+    }
+    cout << (g.hasCycle() ? "cycle" : "acyclic") << endl;
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+struct Item {
+    string name;
+    int quantity;
+    double price;
+};
+
+class Inventory {
+    unordered_map<string, Item> items;
+    mutable mutex lock;
+
+public:
+    void add(const string& name, int quantity, double price) {
+        lock_guard<mutex> guard(lock);
+        auto it = items.find(name);
+        if (it == items.end()) {
+            items[name] = {name, quantity, price};
+        } else {
+            it->second.quantity += quantity;
+            it->second.price = price;
+        }
+    }
+
+    bool remove(const string& name, int quantity) {
+        lock_guard<mutex> guard(lock);
+        auto it = items.find(name);
+        if (it == items.end() || it->second.quantity < quantity) return false;
+        it->second.quantity -= quantity;
+        if (it->second.quantity == 0) items.erase(it);
+        return true;
+    }
+
+    double totalValue() const {
+        lock_guard<mutex> guard(lock);
+        double total = 0.0;
+        for (const auto& [name, item] : items) total += item.quantity * item.price;
+        return total;
+    }
+
+    vector<Item> sortedByValue() const {
+        lock_guard<mutex> guard(lock);
+        vector<Item> result;
+        result.reserve(items.size());
+        for (const auto& entry : items) result.push_back(entry.second);
+        sort(result.begin(), result.end(), [](const Item& a, const Item& b) {
+            return a.quantity * a.price > b.quantity * b.price;
+        });
+        return result;
+    }
+};
+
+int main(int argc, char** argv) {
+    Inventory inventory;
+    string command, name;
+    int quantity;
+    double price;
+    while (cin >> command) {
+        if (command == "add") {
+            cin >> name >> quantity >> price;
+            inventory.add(name, quantity, price);
+        } else if (command == "remove") {
+            cin >> name >> quantity;
+            if (!inventory.remove(name, quantity)) cerr << "cannot remove " << name << endl;
+        } else if (command == "report") {
+            for (const auto& item : inventory.sortedByValue()) {
+                printf("%-20s %5d %10.2f\n", item.name.c_str(), item.quantity, item.price);
+            }
+            printf("total: %.2f\n", inventory.totalValue());
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+struct Node {
+    int value;
+    Node* next;
+};
+
+Node* push_front(Node* head, int value) {
+    Node* node = (Node*)malloc(sizeof(Node));
+    node->value = value;
+    node->next = head;
+    return node;
+}
+
+Node* reverse(Node* head) {
+    Node* prev = nullptr;
+    while (head != nullptr) {
+        Node* next = head->next;
+        head->next = prev;
+        prev = head;
+        head = next;
+    }
+    return prev;
+}
+
+void free_list(Node* head) {
+    while (head) {
+        Node* next = head->next;
+        free(head);
+        head = next;
+    }
+}
+
+int count_words(const char* text) {
+    int count = 0;
+    bool in_word = false;
+    for (const char* p = text; *p; ++p) {
+        if (*p == ' ' || *p == '\t' || *p == '\n') {
+            in_word = false;
+        } else if (!in_word) {
+            in_word = true;
+            ++count;
+        }
+    }
+    return count;
+}
+
+#define MAX_LINE 1024
+
+int main(void) {
+    char buffer[MAX_LINE];
+    Node* list = nullptr;
+    while (fgets(buffer, sizeof buffer, stdin) != NULL) {
+        buffer[strcspn(buffer, "\n")] = '\0';
+        list = push_front(list, count_words(buffer));
+    }
+    list = reverse(list);
+    for (Node* p = list; p; p = p->next) {
+        printf("%d\n", p->value);
+    }
+    free_list(list);
+    return EXIT_SUCCESS;
+}
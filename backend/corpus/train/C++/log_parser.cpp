@@ -0,0 +1,53 @@
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <unordered_map>
+
+enum class Level { Debug, Info, Warn, Error };
+
+class LogParser {
+public:
+    void accept(const std::string& line) {
+        static const std::regex pattern(R"(^(\S+) \[(\w+)\] (.*)$)");
+        std::smatch m;
+        if (!std::regex_match(line, m, pattern)) {
+            ++malformed_;
+            return;
+        }
+        auto it = levels_.find(m[2].str());
+        if (it == levels_.end()) {
+            ++malformed_;
+            return;
+        }
+        ++counts_[static_cast<size_t>(it->second)];
+    }
+
+    int count(Level level) const { return counts_[static_cast<size_t>(level)]; }
+    int malformed() const { return malformed_; }
+
+private:
+    const std::unordered_map<std::string, Level> levels_{
+        {"DEBUG", Level::Debug}, {"INFO", Level::Info}, {"WARN", Level::Warn}, {"ERROR", Level::Error}};
+    std::array<int, 4> counts_{};
+    int malformed_ = 0;
+};
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        std::cerr << "usage: " << argv[0] << " <file>\n";
+        return 1;
+    }
+    std::ifstream in(argv[1]);
+    if (!in) {
+        std::cerr << "cannot open " << argv[1] << '\n';
+        return 1;
+    }
+    LogParser parser;
+    for (std::string line; std::getline(in, line);) parser.accept(line);
+    const char* names[] = {"DEBUG", "INFO", "WARN", "ERROR"};
+    for (int i = 0; i < 4; ++i)
+        std::cout << names[i] << ": " << parser.count(static_cast<Level>(i)) << '\n';
+    std::cout << "malformed: " << parser.malformed() << '\n';
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <ostream>
+
+namespace linalg {
+
+template <typename T>
+class Matrix {
+public:
+    Matrix(std::size_t rows, std::size_t cols, T value = T{})
+        : rows_(rows), cols_(cols), data_(rows * cols, value) {}
+
+    std::size_t rows() const noexcept { return rows_; }
+    std::size_t cols() const noexcept { return cols_; }
+
+    T& operator()(std::size_t r, std::size_t c) { return data_[r * cols_ + c]; }
+    const T& operator()(std::size_t r, std::size_t c) const { return data_[r * cols_ + c]; }
+
+    Matrix operator*(const Matrix& other) const {
+        if (cols_ != other.rows_) {
+            throw std::invalid_argument("dimension mismatch");
+        }
+        Matrix result(rows_, other.cols_);
+        for (std::size_t i = 0; i < rows_; ++i)
+            for (std::size_t k = 0; k < cols_; ++k)
+                for (std::size_t j = 0; j < other.cols_; ++j)
+                    result(i, j) += (*this)(i, k) * other(k, j);
+        return result;
+    }
+
+    Matrix transposed() const {
+        Matrix result(cols_, rows_);
+        for (std::size_t i = 0; i < rows_; ++i)
+            for (std::size_t j = 0; j < cols_; ++j)
+                result(j, i) = (*this)(i, j);
+        return result;
+    }
+
+    static Matrix identity(std::size_t n) {
+        Matrix result(n, n);
+        for (std::size_t i = 0; i < n; ++i) result(i, i) = T{1};
+        return result;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const Matrix& m) {
+        for (std::size_t i = 0; i < m.rows_; ++i) {
+            for (std::size_t j = 0; j < m.cols_; ++j) os << m(i, j) << ' ';
+            os << '\n';
+        }
+        return os;
+    }
+
+private:
+    std::size_t rows_;
+    std::size_t cols_;
+    std::vector<T> data_;
+};
+
+} // namespace linalg
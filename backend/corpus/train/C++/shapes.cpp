@@ -0,0 +1,58 @@
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <cmath>
+#include <string>
+
+class Shape {
+public:
+    virtual ~Shape() = default;
+    virtual double area() const = 0;
+    virtual double perimeter() const = 0;
+    virtual std::string name() const { return "shape"; }
+};
+
+class Circle : public Shape {
+    double radius;
+public:
+    explicit Circle(double r) : radius(r) {}
+    double area() const override { return M_PI * radius * radius; }
+    double perimeter() const override { return 2 * M_PI * radius; }
+    std::string name() const override { return "circle"; }
+};
+
+class Rectangle : public Shape {
+    double width, height;
+public:
+    Rectangle(double w, double h) : width(w), height(h) {}
+    double area() const override { return width * height; }
+    double perimeter() const override { return 2 * (width + height); }
+    std::string name() const override { return "rectangle"; }
+};
+
+template <typename T, typename... Args>
+std::unique_ptr<Shape> make(Args&&... args) {
+    return std::make_unique<T>(std::forward<Args>(args)...);
+}
+
+int main() {
+    std::vector<std::unique_ptr<Shape>> shapes;
+    shapes.push_back(make<Circle>(1.5));
+    shapes.push_back(make<Rectangle>(2.0, 3.0));
+    shapes.emplace_back(new Circle(0.5));
+
+    double total = 0;
+    for (const auto& shape : shapes) {
+        std::cout << shape->name() << ": area=" << shape->area()
+                  << " perimeter=" << shape->perimeter() << std::endl;
+        total += shape->area();
+    }
+    std::cout << "total area " << total << std::endl;
+
+    constexpr int N = 10;
+    int squares[N];
+    for (int i = 0; i < N; i++) squares[i] = i * i;
+    static_assert(N > 0, "N must be positive");
+    std::cout << squares[N - 1] << "\n";
+    return 0;
+}
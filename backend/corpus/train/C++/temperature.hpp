@@ -0,0 +1,39 @@
+#pragma once
+
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+struct Temperature {
+    std::string city;
+    double celsius = 0.0;
+
+    Temperature(std::string c, double value) : city(std::move(c)), celsius(value) {
+        if (value < -273.15) throw std::out_of_range("below absolute zero");
+    }
+
+    double fahrenheit() const { return celsius * 9.0 / 5.0 + 32.0; }
+
+    bool operator<(const Temperature& other) const { return celsius < other.celsius; }
+};
+
+inline std::optional<Temperature> warmest(const std::vector<Temperature>& readings) {
+    if (readings.empty()) return std::nullopt;
+    auto it = std::max_element(readings.begin(), readings.end());
+    return *it;
+}
+
+inline double average(const std::vector<Temperature>& readings) {
+    if (readings.empty()) return 0.0;
+    double total = 0.0;
+    for (const auto& r : readings) total += r.celsius;
+    return total / static_cast<double>(readings.size());
+}
+
+template <typename Pred>
+std::vector<Temperature> filter(const std::vector<Temperature>& readings, Pred pred) {
+    std::vector<Temperature> out;
+    std::copy_if(readings.begin(), readings.end(), std::back_inserter(out), pred);
+    return out;
+}
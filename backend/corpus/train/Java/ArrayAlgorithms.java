@@ -0,0 +1,72 @@
+import java.util.Arrays;
+
+public final class ArrayAlgorithms {
+
+    private ArrayAlgorithms() {
+    }
+
+    public static int max(int[] values) {
+        if (values.length == 0) {
+            throw new IllegalArgumentException("empty array");
+        }
+        int best = values[0];
+        for (int i = 1; i < values.length; i++) {
+            if (values[i] > best) {
+                best = values[i];
+            }
+        }
+        return best;
+    }
+
+    public static long sum(int[] values) {
+        long total = 0;
+        for (int v : values) {
+            total += v;
+        }
+        return total;
+    }
+
+    public static int binarySearch(int[] sorted, int key) {
+        int low = 0;
+        int high = sorted.length - 1;
+        while (low <= high) {
+            int mid = (low + high) >>> 1;
+            if (sorted[mid] < key) {
+                low = mid + 1;
+            } else if (sorted[mid] > key) {
+                high = mid - 1;
+            } else {
+                return mid;
+            }
+        }
+        return -(low + 1);
+    }
+
+    public static void insertionSort(int[] a) {
+        for (int i = 1; i < a.length; i++) {
+            int key = a[i];
+            int j = i - 1;
+            while (j >= 0 && a[j] > key) {
+                a[j + 1] = a[j];
+                j--;
+            }
+            a[j + 1] = key;
+        }
+    }
+
+    public static int[] prefixSums(int[] values) {
+        int[] sums = new int[values.length + 1];
+        for (int i = 0; i < values.length; i++) {
+            sums[i + 1] = sums[i] + values[i];
+        }
+        return sums;
+    }
+
+    public static void main(String[] args) {
+        int[] data = {5, 3, 9, 1, 7};
+        insertionSort(data);
+        System.out.println(Arrays.toString(data));
+        System.out.println("max = " + max(data) + ", sum = " + sum(data));
+        System.out.println("index of 7: " + binarySearch(data, 7));
+    }
+}
@@ -0,0 +1,67 @@
+package com.example.bank;
+
+import java.math.BigDecimal;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+public class BankAccount {
+    private final String owner;
+    private BigDecimal balance;
+    private final List<String> history = new ArrayList<>();
+
+    public BankAccount(String owner, BigDecimal initialBalance) {
+        if (initialBalance.signum() < 0) {
+            throw new IllegalArgumentException("Initial balance cannot be negative");
+        }
+        this.owner = owner;
+        this.balance = initialBalance;
+    }
+
+    public synchronized void deposit(BigDecimal amount) {
+        if (amount.signum() <= 0) {
+            throw new IllegalArgumentException("Deposit must be positive");
+        }
+        balance = balance.add(amount);
+        history.add("deposit " + amount);
+    }
+
+    public synchronized boolean withdraw(BigDecimal amount) {
+        if (balance.compareTo(amount) < 0) {
+            history.add("failed withdrawal " + amount);
+            return false;
+        }
+        balance = balance.subtract(amount);
+        history.add("withdraw " + amount);
+        return true;
+    }
+
+    public BigDecimal getBalance() {
+        return balance;
+    }
+
+    public String getOwner() {
+        return owner;
+    }
+
+    public List<String> getHistory() {
+        return Collections.unmodifiableList(history);
+    }
+
+    @Override
+    public String toString() {
+        return String.format("%s: %s", owner, balance.toPlainString());
+    }
+
+    public static void main(String[] args) {
+        BankAccount account = new BankAccount("Alice", new BigDecimal("100.00"));
+        account.deposit(new BigDecimal("25.50"));
+        if (!account.withdraw(new BigDecimal("500"))) {
+            System.out.println("Insufficient funds");
+        }
+        System.out.println(account);
+        for (String entry : account.getHistory()) {
+            System.out.println(" - " + entry);
+        }
+    }
+}
@@ -0,0 +1,54 @@
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.function.Consumer;
+
+public class EventBus {
+
+    public interface Event {
+        String name();
+    }
+
+    private final Map<Class<? extends Event>, List<Consumer<? super Event>>> handlers = new HashMap<>();
+
+    @SuppressWarnings("unchecked")
+    public <T extends Event> void subscribe(Class<T> type, Consumer<? super T> handler) {
+        handlers.computeIfAbsent(type, k -> new ArrayList<>()).add((Consumer<? super Event>) handler);
+    }
+
+    public int publish(Event event) {
+        int delivered = 0;
+        for (Map.Entry<Class<? extends Event>, List<Consumer<? super Event>>> entry : handlers.entrySet()) {
+            if (!entry.getKey().isInstance(event)) {
+                continue;
+            }
+            for (Consumer<? super Event> handler : entry.getValue()) {
+                handler.accept(event);
+                delivered++;
+            }
+        }
+        return delivered;
+    }
+
+    static final class UserCreated implements Event {
+        final String user;
+
+        UserCreated(String user) {
+            this.user = user;
+        }
+
+        @Override
+        public String name() {
+            return "user-created";
+        }
+    }
+
+    public static void main(String[] args) {
+        EventBus bus = new EventBus();
+        bus.subscribe(UserCreated.class, e -> System.out.println("welcome " + e.user));
+        bus.subscribe(Event.class, e -> System.out.println("event " + e.name()));
+        int n = bus.publish(new UserCreated("ada"));
+        System.out.println(n + " handlers");
+    }
+}
@@ -0,0 +1,76 @@
+import java.util.Iterator;
+import java.util.NoSuchElementException;
+import java.util.Scanner;
+
+public class LinkedStack<T> implements Iterable<T> {
+    private static class Node<T> {
+        T value;
+        Node<T> next;
+
+        Node(T value, Node<T> next) {
+            this.value = value;
+            this.next = next;
+        }
+    }
+
+    private Node<T> head;
+    private int size;
+
+    public void push(T value) {
+        head = new Node<>(value, head);
+        size++;
+    }
+
+    public T pop() {
+        if (head == null) {
+            throw new NoSuchElementException("stack is empty");
+        }
+        T value = head.value;
+        head = head.next;
+        size--;
+        return value;
+    }
+
+    public boolean isEmpty() {
+        return size == 0;
+    }
+
+    @Override
+    public Iterator<T> iterator() {
+        return new Iterator<T>() {
+            private Node<T> current = head;
+
+            @Override
+            public boolean hasNext() {
+                return current != null;
+            }
+
+            @Override
+            public T next() {
+                T value = current.value;
+                current = current.next;
+                return value;
+            }
+        };
+    }
+
+    public static void main(String[] args) {
+        Scanner scanner = new Scanner(System.in);
+        LinkedStack<Character> stack = new LinkedStack<>();
+        String line = scanner.nextLine();
+        boolean balanced = true;
+        for (char c : line.toCharArray()) {
+            if (c == '(' || c == '[') {
+                stack.push(c);
+            } else if (c == ')' || c == ']') {
+                if (stack.isEmpty()) {
+                    balanced = false;
+                    break;
+                }
+                stack.pop();
+            }
+        }
+        System.out.println(balanced && stack.isEmpty() ? "balanced" : "unbalanced");
+        scanner.close();
+    }
+}
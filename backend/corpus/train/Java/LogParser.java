@@ -0,0 +1,60 @@
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.EnumMap;
+import java.util.Map;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+import java.util.stream.Stream;
+
+public class LogParser {
+    enum Level { DEBUG, INFO, WARN, ERROR }
+
+    private static final Pattern LINE = Pattern.compile("^(\\S+) \\[(\\w+)\\] (.*)$");
+
+    private final Map<Level, Integer> counts = new EnumMap<>(Level.class);
+    private int malformed;
+
+    public void accept(String line) {
+        Matcher m = LINE.matcher(line);
+        if (!m.matches()) {
+            malformed++;
+            return;
+        }
+        try {
+            Level level = Level.valueOf(m.group(2));
+            counts.merge(level, 1, Integer::sum);
+        } catch (IllegalArgumentException e) {
+            malformed++;
+        }
+    }
+
+    public int count(Level level) {
+        return counts.getOrDefault(level, 0);
+    }
+
+    public int getMalformed() {
+        return malformed;
+    }
+
+    public static LogParser parse(Path path) throws IOException {
+        LogParser parser = new LogParser();
+        try (Stream<String> lines = Files.lines(path)) {
+            lines.forEach(parser::accept);
+        }
+        return parser;
+    }
+
+    public static void main(String[] args) throws IOException {
+        if (args.length != 1) {
+            System.err.println("usage: LogParser <file>");
+            return;
+        }
+        LogParser parser = parse(Paths.get(args[0]));
+        for (Level level : Level.values()) {
+            System.out.println(level + ": " + parser.count(level));
+        }
+        System.out.println("malformed: " + parser.getMalformed());
+    }
+}
@@ -0,0 +1,63 @@
+package geometry;
+
+public abstract class Shape implements Comparable<Shape> {
+    protected final String name;
+
+    protected Shape(String name) {
+        this.name = name;
+    }
+
+    public abstract double area();
+
+    public abstract double perimeter();
+
+    @Override
+    public int compareTo(Shape other) {
+        return Double.compare(area(), other.area());
+    }
+
+    public static final class Circle extends Shape {
+        private final double radius;
+
+        public Circle(double radius) {
+            super("circle");
+            this.radius = radius;
+        }
+
+        @Override
+        public double area() {
+            return Math.PI * radius * radius;
+        }
+
+        @Override
+        public double perimeter() {
+            return 2 * Math.PI * radius;
+        }
+    }
+
+    public static final class Rectangle extends Shape {
+        private final double width;
+        private final double height;
+
+        public Rectangle(double width, double height) {
+            super("rectangle");
+            this.width = width;
+            this.height = height;
+        }
+
+        @Override
+        public double area() {
+            return width * height;
+        }
+
+        @Override
+        public double perimeter() {
+            return 2 * (width + height);
+        }
+    }
+
+    public interface Visitor<R> {
+        R visitCircle(Circle circle);
+        R visitRectangle(Rectangle rectangle);
+    }
+}
@@ -0,0 +1,64 @@
+package com.example.concurrent;
+
+import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+
+public class TaskQueue implements AutoCloseable {
+    private final BlockingQueue<Runnable> queue = new LinkedBlockingQueue<>();
+    private final ExecutorService workers;
+    private final AtomicInteger completed = new AtomicInteger();
+    private volatile boolean running = true;
+
+    public TaskQueue(int threads) {
+        workers = Executors.newFixedThreadPool(threads);
+        for (int i = 0; i < threads; i++) {
+            workers.submit(this::workLoop);
+        }
+    }
+
+    private void workLoop() {
+        while (running || !queue.isEmpty()) {
+            try {
+                Runnable task = queue.poll(100, TimeUnit.MILLISECONDS);
+                if (task != null) {
+                    task.run();
+                    completed.incrementAndGet();
+                }
+            } catch (InterruptedException e) {
+                Thread.currentThread().interrupt();
+                return;
+            }
+        }
+    }
+
+    public void submit(Runnable task) {
+        if (!running) {
+            throw new IllegalStateException("queue is closed");
+        }
+        queue.offer(task);
+    }
+
+    public int getCompleted() {
+        return completed.get();
+    }
+
+    @Override
+    public void close() throws InterruptedException {
+        running = false;
+        workers.shutdown();
+        workers.awaitTermination(5, TimeUnit.SECONDS);
+    }
+
+    public static void main(String[] args) throws Exception {
+        try (TaskQueue tasks = new TaskQueue(4)) {
+            for (int i = 0; i < 100; i++) {
+                final int n = i;
+                tasks.submit(() -> System.out.println("task " + n));
+            }
+        }
+    }
+}
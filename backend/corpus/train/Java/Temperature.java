@@ -0,0 +1,42 @@
+package weather;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Objects;
+import java.util.Optional;
+
+public record Temperature(String city, double celsius) implements Comparable<Temperature> {
+
+    public Temperature {
+        Objects.requireNonNull(city, "city");
+        if (celsius < -273.15) {
+            throw new IllegalArgumentException("below absolute zero: " + celsius);
+        }
+    }
+
+    public double fahrenheit() {
+        return celsius * 9.0 / 5.0 + 32.0;
+    }
+
+    @Override
+    public int compareTo(Temperature other) {
+        return Double.compare(celsius, other.celsius);
+    }
+
+    public static Optional<Temperature> warmest(List<Temperature> readings) {
+        return readings.stream().max(Temperature::compareTo);
+    }
+
+    public static double average(List<Temperature> readings) {
+        return readings.stream().mapToDouble(Temperature::celsius).average().orElse(Double.NaN);
+    }
+
+    public static void main(String[] args) {
+        List<Temperature> readings = new ArrayList<>();
+        readings.add(new Temperature("Oslo", -3.5));
+        readings.add(new Temperature("Lisbon", 17.0));
+        readings.add(new Temperature("Cairo", 29.25));
+        warmest(readings).ifPresent(t -> System.out.printf("Warmest: %s (%.1f F)%n", t.city(), t.fahrenheit()));
+        System.out.println("Average: " + average(readings));
+    }
+}
@@ -0,0 +1,38 @@
+import java.io.BufferedReader;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.stream.Collectors;
+
+public class WordCount {
+
+    public static Map<String, Integer> count(BufferedReader reader) throws IOException {
+        Map<String, Integer> counts = new HashMap<>();
+        String line;
+        while ((line = reader.readLine()) != null) {
+            for (String word : line.toLowerCase().split("\\W+")) {
+                if (word.isEmpty()) {
+                    continue;
+                }
+                counts.merge(word, 1, Integer::sum);
+            }
+        }
+        return counts;
+    }
+
+    public static void main(String[] args) {
+        try (BufferedReader reader = new BufferedReader(new InputStreamReader(System.in))) {
+            Map<String, Integer> counts = count(reader);
+            String top = counts.entrySet().stream()
+                    .sorted(Map.Entry.<String, Integer>comparingByValue().reversed())
+                    .limit(10)
+                    .map(e -> e.getKey() + "=" + e.getValue())
+                    .collect(Collectors.joining(", "));
+            System.out.println("Top words: " + top);
+        } catch (IOException e) {
+            System.err.println("Failed to read input: " + e.getMessage());
+            System.exit(1);
+        }
+    }
+}
@@ -0,0 +1,46 @@
+from itertools import accumulate
+
+
+def max_element(values):
+    if not values:
+        raise ValueError("empty list")
+    best = values[0]
+    for v in values[1:]:
+        if v > best:
+            best = v
+    return best
+
+
+def binary_search(sorted_values, key):
+    low, high = 0, len(sorted_values) - 1
+    while low <= high:
+        mid = (low + high) // 2
+        if sorted_values[mid] < key:
+            low = mid + 1
+        elif sorted_values[mid] > key:
+            high = mid - 1
+        else:
+            return mid
+    return -1
+
+
+def insertion_sort(a):
+    for i in range(1, len(a)):
+        key = a[i]
+        j = i - 1
+        while j >= 0 and a[j] > key:
+            a[j + 1] = a[j]
+            j -= 1
+        a[j + 1] = key
+    return a
+
+
+def prefix_sums(values):
+    return [0] + list(accumulate(values))
+
+
+if __name__ == "__main__":
+    data = insertion_sort([5, 3, 9, 1, 7])
+    print(data)
+    print(f"max = {max_element(data)}, sum = {sum(data)}")
+    print("index of 7:", binary_search(data, 7))
@@ -0,0 +1,49 @@
+from collections import defaultdict
+
+
+class Event:
+    name = "event"
+
+
+class UserCreated(Event):
+    name = "user-created"
+
+    def __init__(self, user):
+        self.user = user
+
+
+class EventBus:
+    def __init__(self):
+        self._handlers = defaultdict(list)
+
+    def subscribe(self, event_type, handler=None):
+        if handler is None:
+            def decorator(func):
+                self._handlers[event_type].append(func)
+                return func
+            return decorator
+        self._handlers[event_type].append(handler)
+        return handler
+
+    def publish(self, event):
+        delivered = 0
+        for event_type, handlers in self._handlers.items():
+            if isinstance(event, event_type):
+                for handler in handlers:
+                    handler(event)
+                    delivered += 1
+        return delivered
+
+
+bus = EventBus()
+
+
+@bus.subscribe(UserCreated)
+def welcome(event):
+    print(f"welcome {event.user}")
+
+
+bus.subscribe(Event, lambda e: print("event", e.name))
+
+if __name__ == "__main__":
+    print(bus.publish(UserCreated("ada")), "handlers")
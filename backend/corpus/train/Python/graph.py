@@ -0,0 +1,66 @@
+import heapq
+from collections import defaultdict, deque
+
+
+class Graph:
+    def __init__(self):
+        self.edges = defaultdict(list)
+
+    def add_edge(self, u, v, weight=1):
+        self.edges[u].append((v, weight))
+
+    def bfs(self, start):
+        seen = {start}
+        order = []
+        queue = deque([start])
+        while queue:
+            node = queue.popleft()
+            order.append(node)
+            for neighbour, _ in self.edges[node]:
+                if neighbour not in seen:
+                    seen.add(neighbour)
+                    queue.append(neighbour)
+        return order
+
+    def dijkstra(self, source):
+        dist = {source: 0}
+        heap = [(0, source)]
+        while heap:
+            d, node = heapq.heappop(heap)
+            if d > dist.get(node, float("inf")):
+                continue
+            for neighbour, weight in self.edges[node]:
+                candidate = d + weight
+                if candidate < dist.get(neighbour, float("inf")):
+                    dist[neighbour] = candidate
+                    heapq.heappush(heap, (candidate, neighbour))
+        return dist
+
+    def topological_order(self):
+        indegree = defaultdict(int)
+        for node, targets in list(self.edges.items()):
+            for target, _ in targets:
+                indegree[target] += 1
+        ready = [node for node in self.edges if indegree[node] == 0]
+        order = []
+        while ready:
+            node = ready.pop()
+            order.append(node)
+            for target, _ in self.edges[node]:
+                indegree[target] -= 1
+                if indegree[target] == 0:
+                    ready.append(target)
+        return order
+
+
+def main():
+    graph = Graph()
+    for u, v, w in [("a", "b", 4), ("a", "c", 1), ("c", "b", 2), ("b", "d", 5)]:
+        graph.add_edge(u, v, w)
+    print("BFS:", graph.bfs("a"))
+    print("Distances:", graph.dijkstra("a"))
+    print("Topological:", graph.topological_order())
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,64 @@
+"""Simple inventory management with persistence to JSON."""
+import json
+import os
+from dataclasses import dataclass, asdict, field
+from typing import Dict, List, Optional
+
+
+@dataclass
+class Item:
+    name: str
+    quantity: int = 0
+    price: float = 0.0
+    tags: List[str] = field(default_factory=list)
+
+    @property
+    def value(self) -> float:
+        return self.quantity * self.price
+
+
+class Inventory:
+    def __init__(self, path: Optional[str] = None):
+        self.path = path
+        self.items: Dict[str, Item] = {}
+        if path and os.path.exists(path):
+            self.load()
+
+    def add(self, name, quantity, price=None):
+        item = self.items.setdefault(name, Item(name))
+        item.quantity += quantity
+        if price is not None:
+            item.price = price
+        return item
+
+    def remove(self, name, quantity):
+        item = self.items.get(name)
+        if item is None or item.quantity < quantity:
+            raise ValueError(f"cannot remove {quantity} x {name}")
+        item.quantity -= quantity
+        if item.quantity == 0:
+            del self.items[name]
+
+    def total_value(self):
+        return sum(item.value for item in self.items.values())
+
+    def load(self):
+        with open(self.path, "r", encoding="utf-8") as handle:
+            data = json.load(handle)
+        self.items = {name: Item(**fields) for name, fields in data.items()}
+
+    def save(self):
+        with open(self.path, "w", encoding="utf-8") as handle:
+            json.dump({name: asdict(item) for name, item in self.items.items()}, handle, indent=2)
+
+
+if __name__ == "__main__":
+    inventory = Inventory("inventory.json")
+    inventory.add("widget", 10, 2.5)
+    inventory.add("gadget", 3, 12.0)
+    try:
+        inventory.remove("widget", 20)
+    except ValueError as error:
+        print(error)
+    print(f"Total value: {inventory.total_value():.2f}")
+    inventory.save()
@@ -0,0 +1,53 @@
+import re
+import sys
+from collections import Counter
+from enum import Enum
+from pathlib import Path
+
+LINE = re.compile(r"^(\S+) \[(\w+)\] (.*)$")
+
+
+class Level(Enum):
+    DEBUG = "DEBUG"
+    INFO = "INFO"
+    WARN = "WARN"
+    ERROR = "ERROR"
+
+
+class LogParser:
+    def __init__(self):
+        self.counts = Counter()
+        self.malformed = 0
+
+    def accept(self, line):
+        match = LINE.match(line.rstrip("\n"))
+        if not match:
+            self.malformed += 1
+            return
+        try:
+            self.counts[Level(match.group(2))] += 1
+        except ValueError:
+            self.malformed += 1
+
+    @classmethod
+    def parse(cls, path):
+        parser = cls()
+        with Path(path).open(encoding="utf-8") as lines:
+            for line in lines:
+                parser.accept(line)
+        return parser
+
+
+def main(argv):
+    if len(argv) != 2:
+        print("usage: log_parser.py <file>", file=sys.stderr)
+        return 1
+    parser = LogParser.parse(argv[1])
+    for level in Level:
+        print(f"{level.value}: {parser.counts[level]}")
+    print("malformed:", parser.malformed)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
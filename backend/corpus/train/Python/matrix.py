@@ -0,0 +1,68 @@
+from functools import reduce
+from itertools import product
+import operator
+
+
+class Matrix:
+    def __init__(self, rows):
+        self.rows = [list(row) for row in rows]
+        if len({len(row) for row in self.rows}) > 1:
+            raise ValueError("ragged matrix")
+
+    @classmethod
+    def identity(cls, n):
+        return cls([[1 if i == j else 0 for j in range(n)] for i in range(n)])
+
+    @property
+    def shape(self):
+        return len(self.rows), len(self.rows[0]) if self.rows else 0
+
+    def __getitem__(self, index):
+        i, j = index
+        return self.rows[i][j]
+
+    def __matmul__(self, other):
+        n, m = self.shape
+        m2, p = other.shape
+        if m != m2:
+            raise ValueError(f"shape mismatch: {self.shape} @ {other.shape}")
+        return Matrix(
+            [[sum(self[i, k] * other[k, j] for k in range(m)) for j in range(p)] for i in range(n)]
+        )
+
+    def transpose(self):
+        return Matrix(zip(*self.rows))
+
+    def __eq__(self, other):
+        return isinstance(other, Matrix) and self.rows == other.rows
+
+    def __repr__(self):
+        return "Matrix(%r)" % (self.rows,)
+
+
+def power(matrix, exponent):
+    result = Matrix.identity(matrix.shape[0])
+    while exponent:
+        if exponent & 1:
+            result = result @ matrix
+        matrix = matrix @ matrix
+        exponent >>= 1
+    return result
+
+
+def determinant(rows):
+    n = len(rows)
+    if n == 1:
+        return rows[0][0]
+    total = 0
+    for col in range(n):
+        minor = [row[:col] + row[col + 1:] for row in rows[1:]]
+        total += (-1) ** col * rows[0][col] * determinant(minor)
+    return total
+
+
+if __name__ == "__main__":
+    fib = Matrix([[1, 1], [1, 0]])
+    print(power(fib, 10))
+    print(determinant([[2, 0, 1], [1, 3, 2], [1, 1, 1]]))
+    print(reduce(operator.mul, (x for x, _ in product(range(1, 4), repeat=2)), 1))
@@ -0,0 +1,65 @@
+import argparse
+import asyncio
+import logging
+import re
+import sys
+import time
+
+logger = logging.getLogger(__name__)
+
+LINK_PATTERN = re.compile(r'href="(https?://[^"]+)"')
+
+
+class RateLimiter:
+    """Allow at most `rate` calls per second."""
+
+    def __init__(self, rate):
+        self.interval = 1.0 / rate
+        self.last = 0.0
+        self.lock = asyncio.Lock()
+
+    async def wait(self):
+        async with self.lock:
+            now = time.monotonic()
+            delay = self.last + self.interval - now
+            if delay > 0:
+                await asyncio.sleep(delay)
+            self.last = time.monotonic()
+
+
+async def fetch(url, limiter):
+    await limiter.wait()
+    reader, writer = await asyncio.open_connection(url.split("/")[2], 80)
+    writer.write(f"GET / HTTP/1.0\r\nHost: {url}\r\n\r\n".encode())
+    await writer.drain()
+    body = await reader.read()
+    writer.close()
+    return body.decode(errors="replace")
+
+
+async def crawl(urls, rate):
+    limiter = RateLimiter(rate)
+    results = await asyncio.gather(*(fetch(url, limiter) for url in urls), return_exceptions=True)
+    links = set()
+    for url, result in zip(urls, results):
+        if isinstance(result, Exception):
+            logger.warning("failed to fetch %s: %s", url, result)
+            continue
+        links.update(LINK_PATTERN.findall(result))
+    return sorted(links)
+
+
+def parse_args(argv=None):
+    parser = argparse.ArgumentParser(description="Collect links from pages")
+    parser.add_argument("urls", nargs="+")
+    parser.add_argument("--rate", type=float, default=2.0)
+    parser.add_argument("-v", "--verbose", action="store_true")
+    return parser.parse_args(argv)
+
+
+if __name__ == "__main__":
+    args = parse_args()
+    logging.basicConfig(level=logging.DEBUG if args.verbose else logging.INFO)
+    for link in asyncio.run(crawl(args.urls, args.rate)):
+        print(link)
+    sys.exit(0)
@@ -0,0 +1,37 @@
+from dataclasses import dataclass, field
+from statistics import mean
+from typing import List, Optional
+
+
+@dataclass(order=True)
+class Temperature:
+    celsius: float
+    city: str = field(compare=False)
+
+    def __post_init__(self):
+        if self.celsius < -273.15:
+            raise ValueError(f"below absolute zero: {self.celsius}")
+
+    @property
+    def fahrenheit(self) -> float:
+        return self.celsius * 9 / 5 + 32
+
+
+def warmest(readings: List[Temperature]) -> Optional[Temperature]:
+    return max(readings, default=None)
+
+
+def average(readings: List[Temperature]) -> float:
+    return mean(r.celsius for r in readings) if readings else float("nan")
+
+
+if __name__ == "__main__":
+    readings = [
+        Temperature(-3.5, "Oslo"),
+        Temperature(17.0, "Lisbon"),
+        Temperature(29.25, "Cairo"),
+    ]
+    hottest = warmest(readings)
+    if hottest is not None:
+        print(f"Warmest: {hottest.city} ({hottest.fahrenheit:.1f} F)")
+    print("Average:", average(readings))
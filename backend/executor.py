@@ -0,0 +1,246 @@
+import os
+import re
+import pwd
+import hashlib
+import resource
+import shutil
+import signal
+import subprocess
+import tempfile
+import functools
+from collections import namedtuple
+from absl import logging
+
+# Local sandboxed execution of C++ programs (Linux only, fully offline).
+#
+# - C++ binaries are cached on disk by a hash of source + compiler + flags, so warm
+#   requests skip the compiler entirely. The cache is what survives between requests:
+#   the API route starts a fresh Main.py per request, so a process pool would be cold
+#   every time and is not used.
+# - <bits/stdc++.h> is served from a precompiled header kept in the same cache.
+# - Every compile and run happens under rlimits (CPU, address space, file size, fds).
+# - Jobs get a minimal environment (JOB_ENV), never the server's, which holds API keys.
+# - When running as root, jobs run as an unprivileged user (ZEN_EXEC_USER), so they
+#   cannot modify the binary cache or the backend sources; cached binaries are also
+#   checked against the digest recorded at compile time before every run.
+
+BACKEND_DIR = os.path.dirname(os.path.abspath(__file__))
+CACHE_DIR = os.getenv("ZEN_EXEC_CACHE", os.path.join(BACKEND_DIR, ".exec_cache"))
+CXX = os.getenv("CXX", "g++")
+CXX_FLAGS = ["-std=gnu++17", "-O2"]
+
+CPU_SECONDS = int(os.getenv("ZEN_EXEC_CPU_SECONDS", "10"))
+MEMORY_BYTES = int(os.getenv("ZEN_EXEC_MEMORY_MB", "1024")) * 1024 * 1024
+COMPILE_MEMORY_BYTES = int(os.getenv("ZEN_EXEC_COMPILE_MEMORY_MB", "2048")) * 1024 * 1024
+OUTPUT_BYTES = 16 * 1024 * 1024
+WALL_TIMEOUT = 30
+JOB_USER = os.getenv("ZEN_EXEC_USER", "nobody")
+JOB_ENV = {"PATH": "/usr/local/bin:/usr/bin:/bin", "LANG": "C.UTF-8", "HOME": "/tmp"}
+
+ExecutionResult = namedtuple("ExecutionResult", ["stdout", "stderr", "returncode", "stage", "cached"])
+
+
+def _apply_limits(cpu_seconds=CPU_SECONDS, memory_bytes=MEMORY_BYTES, file_bytes=OUTPUT_BYTES):
+    """Apply resource limits to the current (child) process."""
+    resource.setrlimit(resource.RLIMIT_CPU, (cpu_seconds, cpu_seconds + 1))
+    resource.setrlimit(resource.RLIMIT_AS, (memory_bytes, memory_bytes))
+    resource.setrlimit(resource.RLIMIT_FSIZE, (file_bytes, file_bytes))
+    resource.setrlimit(resource.RLIMIT_CORE, (0, 0))
+    resource.setrlimit(resource.RLIMIT_NOFILE, (64, 64))
+    # Stop the child from gaining privileges through setuid binaries
+    try:
+        import ctypes
+        PR_SET_NO_NEW_PRIVS = 38
+        ctypes.CDLL(None, use_errno=True).prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0)
+    except Exception:
+        pass
+
+
+def _drop_privileges():
+    """Switch a job process to JOB_USER when running as root."""
+    if os.geteuid() != 0:
+        return
+    user = pwd.getpwnam(JOB_USER)
+    os.setgroups([])
+    os.setgid(user.pw_gid)
+    os.setuid(user.pw_uid)
+
+
+def _job_limits(cpu_seconds=CPU_SECONDS, memory_bytes=MEMORY_BYTES):
+    """Limits plus privilege drop for processes running user code."""
+    _apply_limits(cpu_seconds=cpu_seconds, memory_bytes=memory_bytes)
+    _drop_privileges()
+
+
+def _compile_limits():
+    # The precompiled header alone is ~100 MB, so the compiler gets a larger file limit
+    _apply_limits(cpu_seconds=60, memory_bytes=COMPILE_MEMORY_BYTES, file_bytes=512 * 1024 * 1024)
+
+
+_QUOTED_INCLUDE = re.compile(r'^\s*#\s*include\s*"([^"]+)"', re.MULTILINE)
+
+
+def _hash_quoted_includes(source, include_dirs, digest, seen):
+    """Feed the contents of every quoted include (recursively) into the digest.
+
+    Compiles resolve quoted includes from the backend folder (-iquote), so a header such
+    as trigram_model.h changing on disk must change the cache key."""
+    for name in _QUOTED_INCLUDE.findall(source):
+        path = next((os.path.join(d, name) for d in include_dirs
+                     if os.path.isfile(os.path.join(d, name))), None)
+        if path is None or os.path.realpath(path) in seen:
+            continue
+        seen.add(os.path.realpath(path))
+        with open(path, encoding="utf-8", errors="surrogateescape") as file:
+            header = file.read()
+        digest.update(f"\0{name}\0".encode())
+        digest.update(header.encode("utf-8", "surrogateescape"))
+        _hash_quoted_includes(header, [os.path.dirname(path)] + include_dirs, digest, seen)
+
+
+def _source_key(source, include_dir=None):
+    """Cache key covering the source, its quoted includes, the compiler and the flags."""
+    digest = hashlib.sha256()
+    digest.update(_compiler_version().encode())
+    digest.update("\0".join(CXX_FLAGS).encode())
+    digest.update(b"\0")
+    digest.update(source.encode("utf-8", "surrogateescape"))
+    if include_dir:
+        digest.update(include_dir.encode())
+        _hash_quoted_includes(source, [include_dir], digest, set())
+    return digest.hexdigest()
+
+
+def _file_digest(path):
+    digest = hashlib.sha256()
+    with open(path, "rb") as file:
+        for chunk in iter(lambda: file.read(1 << 20), b""):
+            digest.update(chunk)
+    return digest.hexdigest()
+
+
+def _compiler_version():
+    """Identity of the compiler binary (resolved path, size, mtime).
+
+    Cheaper than running `CXX --version` on every request, and it changes whenever the
+    compiler is upgraded or replaced."""
+    path = shutil.which(CXX)
+    if path is None:
+        return CXX
+    path = os.path.realpath(path)
+    info = os.stat(path)
+    return f"{path}\0{info.st_size}\0{info.st_mtime_ns}"
+
+
+def _pch_dir():
+    return os.path.join(CACHE_DIR, "pch", _source_key("<bits/stdc++.h>")[:16])
+
+
+def ensure_precompiled_header():
+    """Build the <bits/stdc++.h> precompiled header once; returns the include dir or None.
+
+    GCC picks up bits/stdc++.h.gch from an -I directory before the real header, so
+    sources including <bits/stdc++.h> use the PCH without any change."""
+    pch_dir = _pch_dir()
+    gch_path = os.path.join(pch_dir, "bits", "stdc++.h.gch")
+    if os.path.exists(gch_path):
+        return pch_dir
+    try:
+        deps = subprocess.run(
+            [CXX] + CXX_FLAGS + ["-x", "c++", "-M", "-"],
+            input="#include <bits/stdc++.h>\n", capture_output=True, text=True)
+        header = next((p for p in deps.stdout.replace("\\", " ").split()
+                       if p.endswith("bits/stdc++.h")), None)
+        if header is None:
+            return None
+
+        os.makedirs(os.path.dirname(gch_path), exist_ok=True)
+        tmp_path = gch_path + f".{os.getpid()}.tmp"
+        build = subprocess.run(
+            [CXX] + CXX_FLAGS + ["-x", "c++-header", header, "-o", tmp_path],
+            capture_output=True, text=True, preexec_fn=_compile_limits)
+        if build.returncode != 0:
+            logging.error(f"Precompiled header build failed: {build.stderr}")
+            return None
+        os.replace(tmp_path, gch_path)
+        return pch_dir
+    except Exception as e:
+        logging.error(f"Precompiled header build failed: {e}")
+        return None
+
+
+def _cached_binary(binary):
+    """True if the cached binary still matches the digest recorded when it was built."""
+    try:
+        with open(binary + ".sha256") as file:
+            expected = file.read().strip()
+        return expected == _file_digest(binary)
+    except OSError:
+        return False
+
+
+def compile_cpp(source):
+    """Compile a C++ source, reusing a cached binary; returns (path, error, cached)."""
+    include_dir = os.getcwd()
+    key = _source_key(source, include_dir)
+    bin_dir = os.path.join(CACHE_DIR, "bin")
+    binary = os.path.join(bin_dir, key)
+    if os.path.exists(binary):
+        if _cached_binary(binary):
+            return binary, None, True
+        logging.error(f"Cached binary {key} does not match its digest; rebuilding")
+
+    os.makedirs(bin_dir, mode=0o755, exist_ok=True)
+    with tempfile.TemporaryDirectory(dir=CACHE_DIR) as work_dir:
+        src_path = os.path.join(work_dir, "main.cpp")
+        with open(src_path, "w", encoding="utf-8", errors="surrogateescape") as file:
+            file.write(source)
+
+        cmd = [CXX] + CXX_FLAGS
+        pch_dir = ensure_precompiled_header()
+        if pch_dir:
+            cmd += ["-I", pch_dir]
+        # Quoted includes keep resolving relative to the backend folder
+        cmd += ["-iquote", include_dir, src_path, "-o", os.path.join(work_dir, "main")]
+
+        build = subprocess.run(cmd, capture_output=True, text=True,
+                               timeout=WALL_TIMEOUT * 4, preexec_fn=_compile_limits)
+        if build.returncode != 0:
+            return None, build.stderr, False
+        built = os.path.join(work_dir, "main")
+        os.chmod(built, 0o555)
+        with open(built + ".sha256", "w") as file:
+            file.write(_file_digest(built))
+        os.chmod(built + ".sha256", 0o444)
+        os.replace(built + ".sha256", binary + ".sha256")
+        os.replace(built, binary)
+    return binary, None, False
+
+
+def _limit_message(returncode, stderr):
+    """Explain terminations caused by the sandbox limits."""
+    if returncode == -signal.SIGXCPU:
+        return stderr + "CPU time limit exceeded"
+    if returncode == -signal.SIGXFSZ:
+        return stderr + "Output size limit exceeded"
+    return stderr
+
+
+def run_cpp(source, args=(), cwd=None, stdin=None, cpu_seconds=CPU_SECONDS,
+            memory_bytes=MEMORY_BYTES):
+    """Compile (or reuse) and run a C++ source under the job limits; larger limits are for
+    trusted programs such as the analyzer."""
+    os.makedirs(CACHE_DIR, mode=0o755, exist_ok=True)
+    try:
+        binary, error, cached = compile_cpp(source)
+        if binary is None:
+            return ExecutionResult("", error, 1, "compile", False)
+        run = subprocess.run([binary] + list(args), cwd=cwd or os.getcwd(), input=stdin,
+                             capture_output=True, text=True, timeout=WALL_TIMEOUT, env=JOB_ENV,
+                             preexec_fn=functools.partial(_job_limits, cpu_seconds, memory_bytes))
+        return ExecutionResult(run.stdout, _limit_message(run.returncode, run.stderr),
+                               run.returncode, "run", cached)
+    except subprocess.TimeoutExpired:
+        return ExecutionResult("", "Time limit exceeded", -1, "run", False)
+    except Exception as e:
+        return ExecutionResult("", f"Execution failed: {e}", -1, "run", False)
@@ -1,4 +1,11 @@
 #include <bits/stdc++.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "trigram_model.h"
 using namespace std;
 
 // Add this declaration at the start of the file, after includes and before any classes
@@ -12,6 +19,189 @@ struct LexicalError {
     string message;
 };
 
+// Integer token kinds; TOKEN_KIND_NAMES holds the type strings used in lexical units
+enum TokenKind {
+    TOKEN_KEYWORD,
+    TOKEN_IDENTIFIER,
+    TOKEN_OPERATOR,
+    TOKEN_SEPARATOR,
+    TOKEN_STRING_LITERAL,
+    TOKEN_NUMERIC_LITERAL,
+    TOKEN_COMMENT,
+    TOKEN_PREPROCESSOR,
+    TOKEN_HEADER,
+    TOKEN_INVALID_IDENTIFIER,
+    TOKEN_UNKNOWN,
+    TOKEN_KIND_COUNT
+};
+
+const char* const TOKEN_KIND_NAMES[TOKEN_KIND_COUNT] = {
+    "keyword", "identifier", "operator", "separator", "string_literal", "numeric_literal",
+    "comment", "preprocessor", "header", "invalid_identifier", "unknown"
+};
+
+// Source bytes a lexical unit came from; kept parallel to the units like the kinds
+struct TokenSpan {
+    size_t offset;
+    size_t length;
+};
+
+// Cooperative cancellation flag, safe to set from a signal handler
+class CancellationToken {
+    atomic<bool> cancelled{false};
+public:
+    void cancel() { cancelled.store(true, memory_order_relaxed); }
+    bool isCancelled() const { return cancelled.load(memory_order_relaxed); }
+};
+
+// Time budget shared by all analysis phases. Phases poll it once per chunk of work
+// and stop early, keeping whatever they found so far.
+class AnalysisBudget {
+    chrono::steady_clock::time_point deadline;
+    bool limited;
+    const CancellationToken* token;
+
+public:
+    AnalysisBudget(long long milliseconds = 0, const CancellationToken* cancellation = nullptr)
+        : deadline(chrono::steady_clock::now() + chrono::milliseconds(milliseconds)),
+          limited(milliseconds > 0), token(cancellation) {}
+
+    bool exhausted() const {
+        if (token && token->isCancelled()) return true;
+        return limited && chrono::steady_clock::now() >= deadline;
+    }
+
+    string stopReason() const {
+        return token && token->isCancelled() ? "cancelled" : "time budget exhausted";
+    }
+};
+
+const size_t BUDGET_CHUNK = 4096; // Units of work between budget checks
+
+// Polls the budget every BUDGET_CHUNK steps; returns true once the phase must stop
+inline bool budgetExceeded(const AnalysisBudget* budget, size_t step) {
+    return budget && step % BUDGET_CHUNK == 0 && budget->exhausted();
+}
+
+// UTF-8 support for the lexer
+// A malformed byte run inside otherwise valid text
+struct Utf8Run {
+    size_t offset;
+    size_t length;
+};
+
+// Length of the valid UTF-8 sequence starting at i, or 0 if it is malformed
+// (bad lead byte, truncated, overlong, surrogate or beyond U+10FFFF)
+int utf8SequenceLength(const string& text, size_t i) {
+    const unsigned char* s = (const unsigned char*)text.data();
+    size_t n = text.size();
+    unsigned char lead = s[i];
+    if (lead < 0x80) return 1;
+    auto cont = [&](size_t k) { return i + k < n && (s[i + k] & 0xC0) == 0x80; };
+    if (lead >= 0xC2 && lead <= 0xDF) return cont(1) ? 2 : 0;
+    if (lead >= 0xE0 && lead <= 0xEF) {
+        if (!cont(1) || !cont(2)) return 0;
+        if (lead == 0xE0 && s[i + 1] < 0xA0) return 0; // Overlong
+        if (lead == 0xED && s[i + 1] > 0x9F) return 0; // Surrogate
+        return 3;
+    }
+    if (lead >= 0xF0 && lead <= 0xF4) {
+        if (!cont(1) || !cont(2) || !cont(3)) return 0;
+        if (lead == 0xF0 && s[i + 1] < 0x90) return 0; // Overlong
+        if (lead == 0xF4 && s[i + 1] > 0x8F) return 0; // Beyond U+10FFFF
+        return 4;
+    }
+    return 0;
+}
+
+uint32_t decodeUtf8(const string& text, size_t i, int length) {
+    const unsigned char* s = (const unsigned char*)text.data() + i;
+    switch (length) {
+        case 1: return s[0];
+        case 2: return ((s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+        case 3: return ((s[0] & 0x0F) << 12) | ((s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        default: return ((s[0] & 0x07) << 18) | ((s[1] & 0x3F) << 12) | ((s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+    }
+}
+
+// Finds all malformed byte runs; adjacent bad bytes are merged into one run.
+// ASCII is skipped 64 bytes at a time with SSE2 (one movemask per 4 loads), so
+// typical source text validates at memory speed and only non-ASCII bytes take the
+// scalar path.
+vector<Utf8Run> findMalformedUtf8(const string& text) {
+    vector<Utf8Run> runs;
+    const char* data = text.data();
+    size_t n = text.size();
+    size_t i = 0;
+    while (i < n) {
+#if defined(__SSE2__)
+        while (i + 64 <= n) {
+            __m128i a = _mm_loadu_si128((const __m128i*)(data + i));
+            __m128i b = _mm_loadu_si128((const __m128i*)(data + i + 16));
+            __m128i c = _mm_loadu_si128((const __m128i*)(data + i + 32));
+            __m128i d = _mm_loadu_si128((const __m128i*)(data + i + 48));
+            __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+            if (_mm_movemask_epi8(any) != 0) break;
+            i += 64;
+        }
+        while (i + 16 <= n && _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(data + i))) == 0) i += 16;
+#endif
+        if (i >= n) break;
+        if ((unsigned char)data[i] < 0x80) {
+            i++;
+            continue;
+        }
+        int length = utf8SequenceLength(text, i);
+        if (length > 0) {
+            i += length;
+            continue;
+        }
+        if (!runs.empty() && runs.back().offset + runs.back().length == i) runs.back().length++;
+        else runs.push_back({i, 1});
+        i++;
+    }
+    return runs;
+}
+
+// 1-based column of a byte offset on the line starting at lineStart; with utf8 set,
+// columns count code points rather than bytes
+int columnOf(const string& text, size_t lineStart, size_t offset, bool utf8) {
+    int column = 1;
+    for (size_t k = lineStart; k < offset && k < text.size(); k++) {
+        if (!utf8 || ((unsigned char)text[k] & 0xC0) != 0x80) column++;
+    }
+    return column;
+}
+
+// Column after the byte c, for scans that track the column as they go
+inline int nextColumn(int column, char c, bool utf8) {
+    if (c == '\n') return 1;
+    return column + (!utf8 || ((unsigned char)c & 0xC0) != 0x80);
+}
+
+// Non-ASCII code points accepted in identifiers: letters of the common scripts plus
+// combining marks. Sorted, so membership is a binary search over a few dozen ranges.
+const pair<uint32_t, uint32_t> IDENTIFIER_RANGES[] = {
+    {0x00AA, 0x00AA}, {0x00B5, 0x00B5}, {0x00BA, 0x00BA}, {0x00C0, 0x00D6},
+    {0x00D8, 0x00F6}, {0x00F8, 0x02C1}, {0x02C6, 0x02D1}, {0x02E0, 0x02E4},
+    {0x0300, 0x036F}, {0x0370, 0x0374}, {0x0376, 0x0377}, {0x037B, 0x037D},
+    {0x037F, 0x037F}, {0x0386, 0x0386}, {0x0388, 0x03FF}, {0x0400, 0x0481},
+    {0x0483, 0x052F}, {0x0531, 0x0556}, {0x0561, 0x0587}, {0x05B0, 0x05EA},
+    {0x0620, 0x0669}, {0x066E, 0x06D3}, {0x0900, 0x0963}, {0x0966, 0x097F},
+    {0x0E01, 0x0E3A}, {0x0E40, 0x0E4E}, {0x0E50, 0x0E59}, {0x10A0, 0x10FF},
+    {0x1100, 0x11FF}, {0x1E00, 0x1FBC}, {0x1FC2, 0x1FCC}, {0x1FD0, 0x1FDB},
+    {0x1FE0, 0x1FEC}, {0x1FF2, 0x1FFC}, {0x2070, 0x2071}, {0x207F, 0x207F},
+    {0x3041, 0x3096}, {0x3099, 0x309F}, {0x30A1, 0x30FF}, {0x3400, 0x4DBF},
+    {0x4E00, 0x9FFF}, {0xAC00, 0xD7A3}, {0xF900, 0xFAFF}, {0xFF10, 0xFF19},
+    {0xFF21, 0xFF3A}, {0xFF41, 0xFF5A}, {0xFF66, 0xFFDC}, {0x20000, 0x2FA1F},
+};
+
+bool isIdentifierCodePoint(uint32_t cp) {
+    if (cp < 0x80) return isalnum((int)cp) || cp == '_';
+    auto it = upper_bound(begin(IDENTIFIER_RANGES), end(IDENTIFIER_RANGES), make_pair(cp, UINT32_MAX));
+    return it != begin(IDENTIFIER_RANGES) && prev(it)->second >= cp;
+}
+
 // Enhanced TrieNode with frequency and language statistics
 struct TrieNode {
     unordered_map<char, TrieNode*> children;
@@ -83,11 +273,13 @@ private:
                 size_t angleEnd = directive.find('>');
                 if (angleStart != string::npos && angleEnd != string::npos) {
                     // Split into #include and header
-                    lexicalUnits.push_back({"#include", "preprocessor"});
-                    lexicalUnits.push_back({directive.substr(angleStart, angleEnd - angleStart + 1), "header"});
+                    addUnit(lexicalUnits, "#include", TOKEN_PREPROCESSOR, start, 8);
+                    addUnit(lexicalUnits, directive.substr(angleStart, angleEnd - angleStart + 1), TOKEN_HEADER,
+                            start + angleStart, angleEnd - angleStart + 1);
                 } else {
-                    lexicalUnits.push_back({directive, "preprocessor"});
+                    addUnit(lexicalUnits, directive, TOKEN_PREPROCESSOR, start, directive.length());
                 }
+                i--; // Leave the newline for the main loop
                 return true;
             }
             // Reset if not a preprocessor directive
@@ -100,29 +292,34 @@ private:
         // C++ style single-line comment
         if (code[i] == '/' && code[i + 1] == '/') {
             string comment = "//";
+            size_t start = i;
             i += 2; // Move past comment markers
             while (i < code.length() && code[i] != '\n') {
                 comment += code[i++];
             }
-            lexicalUnits.push_back({comment, "comment"});
+            addUnit(lexicalUnits, comment, TOKEN_COMMENT, start, comment.length());
+            i--; // Leave the newline for the main loop
             return true;
         }
         
         // Handle C++/Java multi-line comments
         if (code[i] == '/' && code[i + 1] == '*') {
             string comment = "/*";
+            size_t start = i;
             i += 2; // Move past comment markers
             while (i + 1 < code.length()) {
                 if (code[i] == '*' && code[i + 1] == '/') {
                     comment += "*/";
-                    i += 2;
-                    lexicalUnits.push_back({comment, "comment"});
+                    i++; // Main loop steps past the closing '/'
+                    addUnit(lexicalUnits, comment, TOKEN_COMMENT, start, comment.length());
                     return true;
                 }
                 comment += code[i++];
             }
             // Auto-close any unclosed comments
-            lexicalUnits.push_back({comment + "*/", "comment"});
+            comment += code.substr(i);
+            i = code.length() - 1;
+            addUnit(lexicalUnits, comment + "*/", TOKEN_COMMENT, start, code.length() - start);
             return true;
         }
         
@@ -131,14 +328,38 @@ private:
 
     // Returns true if character is not printable and not whitespace
     bool isInvalidChar(char c) {
-        return !isprint(c) && !isspace(c);
+        return !isprint((unsigned char)c) && !isspace((unsigned char)c);
+    }
+
+    // Appends a lexical unit and records its integer kind and source span alongside it
+    void addUnit(vector<pair<string, string>>& lexicalUnits, const string& text, TokenKind kind,
+                 size_t offset, size_t length) {
+        lexicalUnits.push_back({text, TOKEN_KIND_NAMES[kind]});
+        unitKinds.push_back(kind);
+        unitSpans.push_back({offset, length});
     }
 
     // Records a lexical error with position and description
-    void addLexicalError(int line, int character, const string& token, const string& message) {
+    void addLexicalError(size_t offset, const string& token, const string& message) {
+        auto [line, character] = positionOf(offset);
         lexicalErrors.push_back({line, character, token, message});
     }
 
+    // Line and column (1-based) of a byte offset; in UTF-8 mode columns count code points.
+    // Errors arrive mostly in offset order, so counting resumes from the last position on
+    // the same line instead of rescanning the line from its start.
+    pair<int, int> positionOf(size_t offset) {
+        size_t line = upper_bound(lineStarts.begin(), lineStarts.end(), offset) - lineStarts.begin();
+        if (line != cachedLine || offset < cachedOffset) {
+            cachedLine = line;
+            cachedOffset = lineStarts[line - 1];
+            cachedColumn = 1;
+        }
+        cachedColumn += columnOf(*source, cachedOffset, offset, utf8Mode) - 1;
+        cachedOffset = offset;
+        return {(int)line, cachedColumn};
+    }
+
 public:
     // Initialize analyzer with supported language elements
     LexicalAnalyzer() {
@@ -164,38 +385,87 @@ public:
         };
     }
 
+    // Switches between UTF-8 lexing (default) and the legacy byte-per-character mode
+    void setUtf8Mode(bool enabled) {
+        utf8Mode = enabled;
+    }
+
+    bool isUtf8Mode() const {
+        return utf8Mode;
+    }
+
     // Main analysis function - breaks code into tokens
-    vector<pair<string, string>> analyzeLexically(const string& code) {
+    // With a budget, lexing stops early and getLexedBytes() reports how far it got
+    vector<pair<string, string>> analyzeLexically(const string& code, const AnalysisBudget* budget = nullptr) {
         vector<pair<string, string>> lexicalUnits;
         string currentToken;
-        int currentLine = 1;
-        int currentChar = 1;
         lexicalErrors.clear(); // Clear previous errors
+        unitKinds.clear();
+        unitSpans.clear();
+        lexedBytes = code.length();
+        size_t steps = 0;
+
+        // Index line starts so error positions can be computed from byte offsets
+        source = &code;
+        cachedLine = SIZE_MAX;
+        lineStarts.assign(1, 0);
+        for (size_t i = 0; i < code.length(); i++) {
+            if (code[i] == '\n') lineStarts.push_back(i + 1);
+        }
+        vector<Utf8Run> malformed;
+        if (utf8Mode) malformed = findMalformedUtf8(code);
+        size_t nextMalformed = 0;
+
+        // Reports the malformed runs that start before end. Comment and string scanners
+        // step over their runs, so those get reported once the main loop has passed them.
+        auto reportMalformedBefore = [&](size_t end) {
+            while (nextMalformed < malformed.size() && malformed[nextMalformed].offset < end) {
+                const Utf8Run& run = malformed[nextMalformed++];
+                addLexicalError(run.offset, hexBytes(code.substr(run.offset, run.length)), "Invalid UTF-8 sequence");
+            }
+        };
         
         // Process each character in the code
         for (size_t i = 0; i < code.length(); i++) {
             char c = code[i];
+            if (budgetExceeded(budget, ++steps)) {
+                lexedBytes = i;
+                break;
+            }
 
-            // Update position tracking
-            if (c == '\n') {
-                currentLine++;
-                currentChar = 1;
-            } else {
-                currentChar++;
+            // Multi-byte UTF-8: one error per malformed run, valid code points join the token.
+            // A malformed run ends the current token, so "ab\xFFcd" lexes as ab and cd.
+            if (utf8Mode && (unsigned char)c >= 0x80) {
+                reportMalformedBefore(i);
+                int length = utf8SequenceLength(code, i);
+                bool runStart = nextMalformed < malformed.size() && malformed[nextMalformed].offset == i;
+                if ((runStart || length == 0) && !currentToken.empty()) {
+                    classifyAndAddToken(currentToken, lexicalUnits);
+                    currentToken.clear();
+                }
+                if (runStart) {
+                    const Utf8Run& run = malformed[nextMalformed];
+                    reportMalformedBefore(i + 1);
+                    i += run.length - 1;
+                    continue;
+                }
+                if (length == 0) continue; // Rest of a run that was already reported
+                if (currentToken.empty()) tokenStart = i;
+                currentToken += code.substr(i, length);
+                i += length - 1;
+                continue;
             }
 
             // Check for invalid characters
             if (isInvalidChar(c)) {
-                addLexicalError(currentLine, currentChar, string(1, c), 
-                              "Invalid character detected");
+                addLexicalError(i, string(1, c), "Invalid character detected");
                 continue;
             }
 
             // Check for invalid identifier naming
             if (!currentToken.empty() && currentToken[0] >= '0' && currentToken[0] <= '9') {
-                if (isalpha(c)) {
-                    addLexicalError(currentLine, currentChar - currentToken.length(), 
-                                  currentToken + c, 
+                if (isalpha((unsigned char)c)) {
+                    addLexicalError(tokenStart, currentToken + c,
                                   "Variable name cannot start with a number");
                 }
             }
@@ -218,7 +488,7 @@ public:
                     currentToken.clear();
                 }
                 if (c == '\n') {
-                    lexicalUnits.push_back({"NEWLINE", "separator"});
+                    addUnit(lexicalUnits, "NEWLINE", TOKEN_SEPARATOR, i, 1);
                 }
                 continue;
             }
@@ -229,9 +499,10 @@ public:
                     classifyAndAddToken(currentToken, lexicalUnits);
                     currentToken.clear();
                 }
-                string stringLiteral = extractStringLiteral(code, i, c);
-                lexicalUnits.push_back({stringLiteral, "string_literal"});
-                i += stringLiteral.length() + 1;
+                size_t end;
+                string stringLiteral = extractStringLiteral(code, i, c, end);
+                addUnit(lexicalUnits, stringLiteral, TOKEN_STRING_LITERAL, i, min(end + 1, code.length()) - i);
+                i = end; // Closing quote, or the end of an unterminated literal
                 continue;
             }
             
@@ -244,7 +515,7 @@ public:
                         classifyAndAddToken(currentToken, lexicalUnits);
                         currentToken.clear();
                     }
-                    lexicalUnits.push_back({twoCharOp, "operator"});
+                    addUnit(lexicalUnits, twoCharOp, TOKEN_OPERATOR, i, 2);
                     i++;
                     continue;
                 }
@@ -254,7 +525,7 @@ public:
                     classifyAndAddToken(currentToken, lexicalUnits);
                     currentToken.clear();
                 }
-                lexicalUnits.push_back({possibleOp, "operator"});
+                addUnit(lexicalUnits, possibleOp, TOKEN_OPERATOR, i, 1);
                 continue;
             }
             
@@ -264,11 +535,12 @@ public:
                     classifyAndAddToken(currentToken, lexicalUnits);
                     currentToken.clear();
                 }
-                lexicalUnits.push_back({string(1, c), "separator"});
+                addUnit(lexicalUnits, string(1, c), TOKEN_SEPARATOR, i, 1);
                 continue;
             }
             
             // Add character to current token
+            if (currentToken.empty()) tokenStart = i;
             currentToken += c;
         }
         
@@ -276,6 +548,13 @@ public:
         if (!currentToken.empty()) {
             classifyAndAddToken(currentToken, lexicalUnits);
         }
+
+        // Runs in a trailing comment or string were never reached by the loop; late
+        // reports are put back into source order
+        reportMalformedBefore(lexedBytes);
+        stable_sort(lexicalErrors.begin(), lexicalErrors.end(), [](const LexicalError& a, const LexicalError& b) {
+            return a.line != b.line ? a.line < b.line : a.character < b.character;
+        });
         
         return lexicalUnits;
     }
@@ -286,34 +565,50 @@ public:
         return lexicalErrors;
     }
 
+    // Integer kind of every unit returned by the last analysis (parallel to the units)
+    const vector<TokenKind>& getTokenKinds() const {
+        return unitKinds;
+    }
+
+    // Source span of every unit returned by the last analysis (parallel to the units)
+    const vector<TokenSpan>& getTokenSpans() const {
+        return unitSpans;
+    }
+
+    // Bytes consumed by the last analysis (less than the input if the budget ran out)
+    size_t getLexedBytes() const {
+        return lexedBytes;
+    }
+
 private:
     // Classifies token type and adds to lexical units
     void classifyAndAddToken(const string& token, vector<pair<string, string>>& lexicalUnits) {
         // Check for invalid identifiers
-        if (isdigit(token[0]) && any_of(token.begin(), token.end(), ::isalpha)) {
-            lexicalUnits.push_back({token, "invalid_identifier"});
-            addLexicalError(currentLine, currentChar - token.length(), 
-                          token, "Invalid identifier: Cannot start with a number");
+        if (isdigit((unsigned char)token[0]) &&
+            any_of(token.begin(), token.end(), [](char c) { return isalpha((unsigned char)c); })) {
+            addUnit(lexicalUnits, token, TOKEN_INVALID_IDENTIFIER, tokenStart, token.length());
+            addLexicalError(tokenStart, token, "Invalid identifier: Cannot start with a number");
             return;
         }
 
         // Determine token type and add to units
         if (keywords.find(token) != keywords.end()) {
-            lexicalUnits.push_back({token, "keyword"});
+            addUnit(lexicalUnits, token, TOKEN_KEYWORD, tokenStart, token.length());
         }
         else if (isNumber(token)) {
-            lexicalUnits.push_back({token, "numeric_literal"});
+            addUnit(lexicalUnits, token, TOKEN_NUMERIC_LITERAL, tokenStart, token.length());
         }
         else if (isValidIdentifier(token)) {
-            lexicalUnits.push_back({token, "identifier"});
+            addUnit(lexicalUnits, token, TOKEN_IDENTIFIER, tokenStart, token.length());
         }
         else {
-            lexicalUnits.push_back({token, "unknown"});
+            addUnit(lexicalUnits, token, TOKEN_UNKNOWN, tokenStart, token.length());
         }
     }
     
-    // Extracts string literal content between quotes
-    string extractStringLiteral(const string& code, size_t start, char quoteType) {
+    // Extracts string literal content between quotes; end receives the offset of the
+    // closing quote (the input length if the literal is unterminated)
+    string extractStringLiteral(const string& code, size_t start, char quoteType, size_t& end) {
         string literal;
         size_t i = start + 1;
         while (i < code.length() && code[i] != quoteType) {
@@ -325,6 +620,7 @@ private:
                 i++;
             }
         }
+        end = i;
         return literal;
     }
     
@@ -339,18 +635,39 @@ private:
     // Validates identifier naming rules
     bool isValidIdentifier(const string& token) {
         // Must start with letter or underscore
-        if (token.empty() || (!isalpha(token[0]) && token[0] != '_')) {
+        if (token.empty() || isdigit((unsigned char)token[0])) {
             return false;
         }
         
-        // Rest must be alphanumeric or underscore
-        return all_of(token.begin() + 1, token.end(), 
-                     [](char c) { return isalnum(c) || c == '_'; });
+        // Rest must be letters, digits or underscore (non-ASCII letters included)
+        for (size_t i = 0; i < token.size();) {
+            int length = utf8SequenceLength(token, i);
+            if (length == 0 || !isIdentifierCodePoint(decodeUtf8(token, i, length))) return false;
+            i += length;
+        }
+        return true;
     }
 
-    // Position tracking variables
-    int currentLine = 1;
-    int currentChar = 1;
+    static string hexBytes(const string& bytes) {
+        string hex;
+        char buffer[8];
+        for (unsigned char b : bytes) {
+            snprintf(buffer, sizeof(buffer), "\\x%02X", b);
+            hex += buffer;
+        }
+        return hex;
+    }
+
+    // Position tracking state for the current analysis
+    const string* source = nullptr;
+    vector<size_t> lineStarts;
+    size_t cachedLine = SIZE_MAX, cachedOffset = 0; // positionOf cursor
+    int cachedColumn = 1;
+    size_t tokenStart = 0;
+    size_t lexedBytes = 0;
+    bool utf8Mode = true;
+    vector<TokenKind> unitKinds;
+    vector<TokenSpan> unitSpans;
 };
 
 // Language Detection System
@@ -391,13 +708,20 @@ public:
     }
 
 
-    string detectLanguage(const vector<pair<string, string>>& lexicalUnits) {
+    // With a budget, scoring stops early and *complete is set to false
+    string detectLanguage(const vector<pair<string, string>>& lexicalUnits,
+                          const AnalysisBudget* budget = nullptr, bool* complete = nullptr) {
         unordered_map<string, int> scores = {{"C++", 0}, {"Java", 0}, {"Python", 0}};
+        if (complete) *complete = true;
+        size_t steps = 0;
         
         // Analyze each lexical unit
         for (const auto& unit : lexicalUnits) {
+            if (budgetExceeded(budget, ++steps)) {
+                if (complete) *complete = false;
+                break;
+            }
             const string& token = unit.first;
-            const string& type = unit.second;
             
             // Check keywords
             auto [found, languages] = keywordTrie.searchWithInfo(token);
@@ -407,7 +731,7 @@ public:
             }
             
             // Language-specific patterns
-            analyzeSyntaxPatterns(token, type, scores);
+            analyzeSyntaxPatterns(lexicalUnits, &unit - lexicalUnits.data(), scores);
         }
         
         // Analyze overall code structure
@@ -427,22 +751,49 @@ public:
     }
 
 private:
-    void analyzeSyntaxPatterns(const string& token, const string& type, 
-                              unordered_map<string, int>& scores) {
-        // C++ patterns
-        if (token.find("::") != string::npos) scores["C++"] += 3;
-        if (token.find("cout") != string::npos) scores["C++"] += 3;
-        if (token.find("#include") != string::npos) scores["C++"] += 5;
-        
-        // Java patterns
-        if (token.find("System.out.println") != string::npos) scores["Java"] += 5;
-        if (token.find("public class") != string::npos) scores["Java"] += 4;
-        if (token.find("extends") != string::npos) scores["Java"] += 2;
-        
-        // Python patterns
-        if (token.find("def ") != string::npos) scores["Python"] += 4;
-        if (token.find("import ") != string::npos) scores["Python"] += 2;
-        if (token == "self") scores["Python"] += 3;
+    // Token sequences worth extra points, keyed by their last token so each unit costs one
+    // hash lookup. The lexer splits "::" and "System.out.println" into separate tokens, and
+    // string literals and comments are skipped so "def x" in a string does not count.
+    struct SyntaxPattern {
+        vector<string> tokens;
+        string language;
+        int weight;
+    };
+
+    static const unordered_map<string, vector<SyntaxPattern>>& syntaxPatterns() {
+        static const unordered_map<string, vector<SyntaxPattern>> patterns = []() {
+            vector<SyntaxPattern> list = {
+                {{":", ":"}, "C++", 3},
+                {{"cout"}, "C++", 3},
+                {{"#include"}, "C++", 5},
+                {{"System", ".", "out", ".", "println"}, "Java", 5},
+                {{"public", "class"}, "Java", 4},
+                {{"extends"}, "Java", 2},
+                {{"def"}, "Python", 4},
+                {{"import"}, "Python", 2},
+                {{"self"}, "Python", 3},
+            };
+            unordered_map<string, vector<SyntaxPattern>> byLastToken;
+            for (auto& pattern : list) byLastToken[pattern.tokens.back()].push_back(pattern);
+            return byLastToken;
+        }();
+        return patterns;
+    }
+
+    void analyzeSyntaxPatterns(const vector<pair<string, string>>& units, size_t i,
+                               unordered_map<string, int>& scores) {
+        const auto& [token, type] = units[i];
+        if (type == "string_literal" || type == "comment") return;
+        auto it = syntaxPatterns().find(token);
+        if (it == syntaxPatterns().end()) return;
+        for (const SyntaxPattern& pattern : it->second) {
+            size_t length = pattern.tokens.size();
+            if (length > i + 1) continue;
+            bool matched = true;
+            for (size_t k = 0; k + 1 < length && matched; k++)
+                matched = units[i + 1 - length + k].first == pattern.tokens[k];
+            if (matched) scores[pattern.language] += pattern.weight;
+        }
     }
     
     void analyzeCodeStructure(const vector<pair<string, string>>& units,
@@ -472,6 +823,79 @@ private:
     }
 };
 
+// Detection engines
+// Common interface so callers can pick the keyword/trie scorer or the statistical model
+class DetectionEngine {
+public:
+    virtual ~DetectionEngine() {}
+    virtual string name() const = 0;
+    virtual string detect(const string& code) = 0;
+};
+
+// Lexes the input and scores keywords through the trie (LanguageDetector). For --bench-detect;
+// a normal run leaves trie detection to runAnalysis, which shares its lexing and budget
+class TrieDetectionEngine : public DetectionEngine {
+    LexicalAnalyzer lexer;
+    LanguageDetector detector;
+
+public:
+    string name() const override { return "trie"; }
+
+    string detect(const string& code) override {
+        return detector.detectLanguage(lexer.analyzeLexically(code));
+    }
+};
+
+// Bucket of the byte trigram starting at p; must match the hashing used by the trainer
+inline uint32_t trigramBucket(const unsigned char* p) {
+    uint32_t v = p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16);
+    return (v * 2654435761u) >> (32 - TRIGRAM_HASH_BITS);
+}
+
+// Naive-Bayes classifier over hashed byte trigrams, using the weight table generated by
+// --train-trigram (trigram_model.h). Works on the raw buffer, no tokenization.
+class TrigramDetectionEngine : public DetectionEngine {
+public:
+    string name() const override { return "trigram"; }
+
+    string detect(const string& code) override {
+        const unsigned char* p = (const unsigned char*)code.data();
+        size_t n = code.size();
+        if (n < 3) return "Unknown";
+
+        int64_t scores[TRIGRAM_ROW_WIDTH] = {};
+        uint32_t buckets[256];
+        for (size_t base = 0; base + 2 < n; base += 256) {
+            size_t count = min<size_t>(256, n - 2 - base);
+            // Hashing has no dependencies between positions, so this loop vectorizes
+            for (size_t k = 0; k < count; k++) buckets[k] = trigramBucket(p + base + k);
+
+            int32_t partial[TRIGRAM_ROW_WIDTH] = {};
+            for (size_t k = 0; k < count; k++) {
+                const int16_t* row = TRIGRAM_WEIGHTS[buckets[k]];
+                for (int l = 0; l < TRIGRAM_ROW_WIDTH; l++) partial[l] += row[l];
+            }
+            for (int l = 0; l < TRIGRAM_ROW_WIDTH; l++) scores[l] += partial[l];
+        }
+
+        int best = 0;
+        for (int l = 1; l < TRIGRAM_LANGUAGE_COUNT; l++) {
+            if (scores[l] > scores[best]) best = l;
+        }
+        bool tie = false;
+        for (int l = 0; l < TRIGRAM_LANGUAGE_COUNT; l++) {
+            if (l != best && scores[l] == scores[best]) tie = true;
+        }
+        return tie ? "Unknown" : TRIGRAM_LANGUAGES[best];
+    }
+};
+
+unique_ptr<DetectionEngine> makeDetectionEngine(const string& name) {
+    if (name == "trigram") return make_unique<TrigramDetectionEngine>();
+    if (name == "trie") return make_unique<TrieDetectionEngine>();
+    return nullptr;
+}
+
 // Add these new error structs after existing classes
 struct BracketError {
     int line;
@@ -484,11 +908,6 @@ struct QuoteError {
     int character;
 };
 
-struct SemicolonError {
-    int line;
-    string lineContent;
-};
-
 // Custom Stack implementation for bracket matching
 class node {
 public:
@@ -501,41 +920,27 @@ class CustomStack {
 public:
     CustomStack() : head(nullptr), tail(nullptr) {}
     
+    // The top of the stack is the head of the list, so push and pop are O(1)
     void push(char value) {
         node* newNode = new node();
         newNode->data = value;
-        newNode->next = nullptr;
-        if (head == nullptr) {
-            head = newNode;
-            tail = newNode;
-        } else {
-            tail->next = newNode;
-            tail = newNode;
-        }
+        newNode->next = head;
+        head = newNode;
+        if (tail == nullptr) tail = newNode;
     }
     
     char pop() {
         if (head == nullptr) return 'f';
-        if (head == tail) {
-            char value = head->data;
-            delete head;
-            head = nullptr;
-            tail = nullptr;
-            return value;
-        }
-        node* temp = head;
-        while (temp->next != tail) {
-            temp = temp->next;
-        }
-        char value = tail->data;
-        delete tail;
-        tail = temp;
-        tail->next = nullptr;
+        node* oldHead = head;
+        char value = oldHead->data;
+        head = oldHead->next;
+        if (head == nullptr) tail = nullptr;
+        delete oldHead;
         return value;
     }
     
     char top() {
-        return (head == nullptr) ? 'f' : tail->data;
+        return (head == nullptr) ? 'f' : head->data;
     }
     
     bool isEmpty() {
@@ -543,22 +948,138 @@ public:
     }
 };
 
+// Structural block index
+// Bracket pairs (brace languages, taken from the lexer's tokens) or indentation blocks
+// (Python, recorded by the indentation checker), so the editor can ask "enclosing block",
+// "matching bracket" and "folding ranges" without another pass.
+struct BlockNode {
+    size_t open;   // Offset of the opening bracket / start of the block header line
+    size_t close;  // Offset of the closing bracket / last byte of the block
+    int openLine;
+    int closeLine;
+    int parent;    // -1 at top level
+    char kind;     // '(', '{', '[' or ':' for an indentation block
+};
+
+class StructuralIndex {
+    // Blocks live in one contiguous arena in opening order; nodes refer to each other by
+    // index, so building the tree costs no per-node allocations
+    vector<BlockNode> arena;
+    vector<int> byClose;           // Block ids sorted by closing offset
+    vector<size_t> boundaries;     // Offsets where the innermost enclosing block changes
+    vector<int> innermost;         // Innermost block for [boundaries[k], boundaries[k + 1])
+
+    void setBoundary(size_t offset, int block) {
+        if (!boundaries.empty() && boundaries.back() == offset) innermost.back() = block;
+        else {
+            boundaries.push_back(offset);
+            innermost.push_back(block);
+        }
+    }
+
+public:
+    void clear(size_t expectedBlocks = 0) {
+        arena.clear();
+        arena.reserve(expectedBlocks);
+        byClose.clear();
+        boundaries.clear();
+        innermost.clear();
+    }
+
+    int openBlock(size_t offset, int line, char kind, int parent) {
+        arena.push_back({offset, SIZE_MAX, line, -1, parent, kind});
+        return arena.size() - 1;
+    }
+
+    void closeBlock(int id, size_t offset, int line) {
+        arena[id].close = offset;
+        arena[id].closeLine = line;
+    }
+
+    // Closes any blocks still open at end of input and lays out the search arrays.
+    // Blocks are properly nested, so one sweep in opening order yields the boundaries.
+    void finalize(size_t endOffset, int endLine) {
+        for (auto& block : arena) {
+            if (block.close == SIZE_MAX) {
+                block.close = endOffset;
+                block.closeLine = endLine;
+            }
+        }
+
+        byClose.resize(arena.size());
+        iota(byClose.begin(), byClose.end(), 0);
+        sort(byClose.begin(), byClose.end(), [&](int a, int b) { return arena[a].close < arena[b].close; });
+
+        boundaries.clear();
+        innermost.clear();
+        setBoundary(0, -1);
+        vector<int> open;
+        for (int id = 0; id < (int)arena.size(); id++) {
+            while (!open.empty() && arena[open.back()].close < arena[id].open) {
+                size_t end = arena[open.back()].close + 1;
+                open.pop_back();
+                setBoundary(end, open.empty() ? -1 : open.back());
+            }
+            setBoundary(arena[id].open, id);
+            open.push_back(id);
+        }
+        while (!open.empty()) {
+            size_t end = arena[open.back()].close + 1;
+            open.pop_back();
+            setBoundary(end, open.empty() ? -1 : open.back());
+        }
+    }
+
+    // Innermost block containing the offset, or -1; O(log n)
+    int enclosingBlock(size_t offset) const {
+        auto it = upper_bound(boundaries.begin(), boundaries.end(), offset);
+        return it == boundaries.begin() ? -1 : innermost[it - boundaries.begin() - 1];
+    }
+
+    // Offset of the bracket matching the one at `offset`, or -1; O(log n)
+    long long matchingBracket(size_t offset) const {
+        auto byOpen = lower_bound(arena.begin(), arena.end(), offset,
+                                  [](const BlockNode& b, size_t value) { return b.open < value; });
+        if (byOpen != arena.end() && byOpen->open == offset && byOpen->kind != ':') return byOpen->close;
+        auto closing = lower_bound(byClose.begin(), byClose.end(), offset,
+                                   [&](int id, size_t value) { return arena[id].close < value; });
+        if (closing != byClose.end() && arena[*closing].close == offset && arena[*closing].kind != ':')
+            return arena[*closing].open;
+        return -1;
+    }
+
+    // Blocks spanning more than one line that overlap [firstLine, lastLine]
+    vector<BlockNode> foldingRanges(int firstLine = 1, int lastLine = INT_MAX) const {
+        vector<BlockNode> ranges;
+        for (const auto& block : arena) {
+            if (block.openLine > lastLine) break;
+            if (block.closeLine > block.openLine && block.closeLine >= firstLine) ranges.push_back(block);
+        }
+        return ranges;
+    }
+
+    const BlockNode& block(int id) const { return arena[id]; }
+    size_t size() const { return arena.size(); }
+};
+
 // Add these new functions before main()
-vector<QuoteError> checkQuotes(const string& text) {
+// Checkers take an optional budget; *processed receives how many bytes (or lines) were
+// checked, and end-of-input errors are only reported when the whole input was seen
+// Error columns count code points unless utf8Columns is false (--ascii)
+vector<QuoteError> checkQuotes(const string& text, const AnalysisBudget* budget = nullptr,
+                               size_t* processed = nullptr, bool utf8Columns = true) {
     vector<QuoteError> errors;
     bool inQuote = false;
     int currentLine = 1;
-    int currentChar = 1;
+    int currentChar = 1; // Column of position, counted as the scan goes
     int quoteStartLine = 0;
     int quoteStartChar = 0;
+    size_t position = 0;
 
-    for (char c : text) {
-        if (c == '\n') {
-            currentLine++;
-            currentChar = 1;
-        } else {
-            currentChar++;
-        }
+    for (; position < text.length(); position++) {
+        if (budgetExceeded(budget, position + 1)) break;
+        char c = text[position];
+        if (c == '\n') currentLine++;
 
         if (c == '"' || c == '\'') {
             if (inQuote) {
@@ -569,44 +1090,50 @@ vector<QuoteError> checkQuotes(const string& text) {
                 quoteStartChar = currentChar;
             }
         }
+        currentChar = nextColumn(currentChar, c, utf8Columns);
     }
 
-    if (inQuote) {
+    if (processed) *processed = position;
+    if (inQuote && position == text.length()) {
         errors.push_back({quoteStartLine, quoteStartChar});
     }
     
     return errors;
 }
 
-vector<BracketError> checkBrackets(const string& text, const string& language) {
+// Error columns count code points unless utf8Columns is false (--ascii).
+vector<BracketError> checkBrackets(const string& text, const string& language,
+                                   const AnalysisBudget* budget = nullptr, size_t* processed = nullptr,
+                                   bool utf8Columns = true) {
     vector<BracketError> errors;
     CustomStack bracketStack;
     int currentLine = 1;
-    int currentChar = 1;
+    int currentChar = 1; // Column of position, counted as the scan goes
+    size_t position = 0;
 
-    for (char c : text) {
-        if (c == '\n') {
-            currentLine++;
-            currentChar = 1;
-        } else {
-            currentChar++;
-        }
+    for (; position < text.length(); position++) {
+        if (budgetExceeded(budget, position + 1)) break;
+        char c = text[position];
+        int column = currentChar;
+        currentChar = nextColumn(currentChar, c, utf8Columns);
+        if (c == '\n') currentLine++;
 
         if (c == '(' || c == '{' || c == '[') {
             bracketStack.push(c);
         } else if (c == ')' || c == '}' || c == ']') {
             if (bracketStack.isEmpty()) {
-                errors.push_back({currentLine, currentChar, c});
+                errors.push_back({currentLine, column, c});
             } else {
                 char top = bracketStack.pop();
                 if ((c == ')' && top != '(') || (c == '}' && top != '{') || (c == ']' && top != '[')) {
-                    errors.push_back({currentLine, currentChar, c});
+                    errors.push_back({currentLine, column, c});
                 }
             }
         }
     }
 
-    while (!bracketStack.isEmpty()) {
+    if (processed) *processed = position;
+    while (position == text.length() && !bracketStack.isEmpty()) {
         char unclosedBracket = bracketStack.pop();
         errors.push_back({-1, -1, unclosedBracket});
     }
@@ -614,8 +1141,42 @@ vector<BracketError> checkBrackets(const string& text, const string& language) {
     return errors;
 }
 
-vector<string> checkPythonIndentation(const string& code) {
+// Indexes the bracket pairs among the first `end` bytes from the lexer's separator tokens,
+// so brackets inside string literals and comments are not blocks. As in checkBrackets, a
+// closing bracket closes the innermost open block; blocks left open run to `end`.
+void indexBracketTokens(const string& code, size_t end, const vector<TokenKind>& kinds,
+                        const vector<TokenSpan>& spans, StructuralIndex& index) {
+    index.clear(spans.size() / 8);
+    vector<int> openBlocks;
+    int line = 1;
+    size_t counted = 0; // Newlines before this offset are included in line
+    for (size_t t = 0; t < spans.size(); t++) {
+        if (kinds[t] != TOKEN_SEPARATOR || spans[t].length != 1) continue;
+        size_t offset = spans[t].offset;
+        char c = code[offset];
+        bool opening = c == '(' || c == '{' || c == '[';
+        if (!opening && c != ')' && c != '}' && c != ']') continue;
+        line += count(code.begin() + counted, code.begin() + offset, '\n');
+        counted = offset;
+        if (opening) {
+            openBlocks.push_back(index.openBlock(offset, line, c, openBlocks.empty() ? -1 : openBlocks.back()));
+        } else if (!openBlocks.empty()) {
+            index.closeBlock(openBlocks.back(), offset, line);
+            openBlocks.pop_back();
+        }
+    }
+    line += count(code.begin() + counted, code.begin() + end, '\n');
+    index.finalize(end == 0 ? 0 : end - 1, line);
+}
+
+// When an index is given, every block opened by a line ending in ':' is recorded in it
+vector<string> checkPythonIndentation(const string& code, const AnalysisBudget* budget = nullptr,
+                                      size_t* processed = nullptr, StructuralIndex* index = nullptr) {
     vector<string> errors;
+    vector<pair<int, int>> openBlocks; // (header indent, block id)
+    size_t lastContentEnd = 0;
+    int lastContentLine = 0;
+    if (index) index->clear(code.length() / 64);
     const int baseIndent = 4;
     int expectedIndent = 0;
     vector<int> indentLevels;  // Change from stack to vector for easier searching
@@ -625,8 +1186,17 @@ vector<string> checkPythonIndentation(const string& code) {
     string line;
     int lineNumber = 0;
 
+    size_t consumed = 0;
+    if (processed) *processed = code.length();
+
     while (getline(iss, line)) {
         lineNumber++;
+        if (budget && lineNumber % 256 == 0 && budget->exhausted()) {
+            if (processed) *processed = consumed;
+            break;
+        }
+        size_t lineStart = consumed;
+        consumed += line.length() + 1;
         
         // Skip empty lines or lines with only whitespace
         if (line.find_first_not_of(" \t") == string::npos) {
@@ -645,6 +1215,12 @@ vector<string> checkPythonIndentation(const string& code) {
         string content = line.substr(line.find_first_not_of(" \t"));
         if (content.empty()) continue;
 
+        // Blocks end at the last content line before a line at or left of their header
+        while (index && !openBlocks.empty() && currentIndent <= openBlocks.back().first) {
+            index->closeBlock(openBlocks.back().second, lastContentEnd, lastContentLine);
+            openBlocks.pop_back();
+        }
+
         // Handle dedent
         while (!indentLevels.empty() && currentIndent < indentLevels.back()) {
             indentLevels.pop_back();
@@ -667,41 +1243,248 @@ vector<string> checkPythonIndentation(const string& code) {
             }
         }
 
+        lastContentEnd = lineStart + line.length() - 1;
+        lastContentLine = lineNumber;
+
         // Handle indent after colon
         if (!content.empty() && content.back() == ':') {
+            if (index) openBlocks.push_back({currentIndent, index->openBlock(
+                lineStart, lineNumber, ':', openBlocks.empty() ? -1 : openBlocks.back().second)});
             indentLevels.push_back(currentIndent + baseIndent);
         } else if (currentIndent > (indentLevels.empty() ? 0 : indentLevels.back())) {
             indentLevels.push_back(currentIndent);
         }
     }
 
+    if (index) {
+        for (const auto& [indent, block] : openBlocks) index->closeBlock(block, lastContentEnd, lastContentLine);
+        index->finalize(lastContentEnd, lastContentLine);
+    }
+
     return errors;
 }
 
-vector<SemicolonError> checkSemicolon(const string& line, int lineNumber, const string& language) {
-    vector<SemicolonError> errors;
-    
-    if (language == "C++") {
-        // Check for C++ I/O statements
-        if (line.find("cout") != string::npos || line.find("cin") != string::npos) {
-            if (line.find(';') == string::npos) {
-                errors.push_back({lineNumber, line});
+// Declarative token-pattern rules
+// One rule per line in the rules file:
+//   <id> <language|*> [^] <pattern tokens...> => <required token> before <terminator token> : <message>
+// e.g. "cpp-cout-semicolon C++ cout => ; before NEWLINE : Missing semicolon" means a line that
+// contains the token `cout` must have a `;` after it before the line ends. A leading ^ anchors
+// the pattern to the first token of the line.
+struct TokenRule {
+    string id;
+    string language;
+    bool anchored = false;
+    vector<string> pattern;
+    string required;
+    string terminator;
+    string message;
+};
+
+// Parses one rule line; returns false for blank lines, comments and malformed rules
+bool parseTokenRule(const string& line, TokenRule& rule) {
+    size_t first = line.find_first_not_of(" \t\r");
+    if (first == string::npos || line[first] == '#') return false;
+
+    size_t arrow = line.find("=>");
+    size_t colon = line.find(" : ", arrow == string::npos ? 0 : arrow);
+    if (arrow == string::npos || colon == string::npos) {
+        logError("Malformed rule: " + line);
+        return false;
+    }
+
+    rule = TokenRule();
+    istringstream lhs(line.substr(0, arrow));
+    lhs >> rule.id >> rule.language;
+    string word;
+    while (lhs >> word) {
+        if (word == "^" && rule.pattern.empty()) rule.anchored = true;
+        else rule.pattern.push_back(word);
+    }
+
+    istringstream rhs(line.substr(arrow + 2, colon - arrow - 2));
+    string before;
+    rhs >> rule.required >> before >> rule.terminator;
+    rule.message = line.substr(colon + 3);
+    while (!rule.message.empty() && isspace((unsigned char)rule.message.back())) rule.message.pop_back();
+
+    if (rule.language.empty() || rule.pattern.empty() || rule.required.empty() ||
+        before != "before" || rule.terminator.empty()) {
+        logError("Malformed rule: " + line);
+        return false;
+    }
+    return true;
+}
+
+vector<TokenRule> loadTokenRules(istream& in) {
+    vector<TokenRule> rules;
+    string line;
+    TokenRule rule;
+    while (getline(in, line)) {
+        if (parseTokenRule(line, rule)) rules.push_back(rule);
+    }
+    return rules;
+}
+
+struct RuleViolation {
+    int line;
+    string ruleId;
+    string message;
+};
+
+// All rule patterns compiled into one Aho-Corasick automaton over token symbols, so the
+// token stream is scanned once no matter how many rules are active. A completed pattern
+// opens an obligation ("required token before terminator") that later tokens settle.
+class RuleAutomaton {
+    struct State {
+        unordered_map<int, int> next;
+        int fail = 0;
+        vector<int> matches; // Rules whose pattern ends in this state
+    };
+
+    vector<TokenRule> rules;
+    vector<State> states;
+    unordered_map<string, int> symbols; // Token text -> symbol id
+    vector<int> requiredSymbol;         // Per rule
+    vector<int> terminatorSymbol;       // Per rule
+    vector<char> isRequired;            // Per symbol
+    vector<char> isTerminator;          // Per symbol
+
+    int internSymbol(const string& text) {
+        auto it = symbols.find(text);
+        if (it != symbols.end()) return it->second;
+        int id = symbols.size();
+        symbols[text] = id;
+        isRequired.push_back(0);
+        isTerminator.push_back(0);
+        return id;
+    }
+
+    int lookupSymbol(const string& text) const {
+        auto it = symbols.find(text);
+        return it == symbols.end() ? -1 : it->second;
+    }
+
+    int step(int state, int symbol) const {
+        if (symbol < 0) return 0;
+        while (true) {
+            auto it = states[state].next.find(symbol);
+            if (it != states[state].next.end()) return it->second;
+            if (state == 0) return 0;
+            state = states[state].fail;
+        }
+    }
+
+public:
+    explicit RuleAutomaton(const vector<TokenRule>& ruleList) : rules(ruleList), states(1) {
+        // Build the trie of patterns
+        for (int r = 0; r < (int)rules.size(); r++) {
+            int state = 0;
+            for (const string& token : rules[r].pattern) {
+                int symbol = internSymbol(token);
+                auto it = states[state].next.find(symbol);
+                if (it == states[state].next.end()) {
+                    states[state].next[symbol] = states.size();
+                    state = states.size();
+                    states.emplace_back();
+                } else {
+                    state = it->second;
+                }
             }
+            states[state].matches.push_back(r);
+            requiredSymbol.push_back(internSymbol(rules[r].required));
+            terminatorSymbol.push_back(internSymbol(rules[r].terminator));
+            isRequired[requiredSymbol[r]] = 1;
+            isTerminator[terminatorSymbol[r]] = 1;
         }
-    } 
-    else if (language == "Java") {
-        // Check for Java I/O statements
-        if (line.find("System.out.println") != string::npos || 
-            line.find("System.out.print") != string::npos ||
-            line.find("Scanner") != string::npos) {
-            if (line.find(';') == string::npos) {
-                errors.push_back({lineNumber, line});
+
+        // Failure links in BFS order; each state inherits the matches of its failure state
+        queue<int> pending;
+        for (const auto& [symbol, child] : states[0].next) pending.push(child);
+        while (!pending.empty()) {
+            int state = pending.front();
+            pending.pop();
+            for (const auto& [symbol, child] : states[state].next) {
+                int fail = state == 0 ? 0 : step(states[state].fail, symbol);
+                states[child].fail = fail == child ? 0 : fail;
+                const auto& inherited = states[states[child].fail].matches;
+                states[child].matches.insert(states[child].matches.end(), inherited.begin(), inherited.end());
+                pending.push(child);
             }
         }
     }
-    
-    return errors;
-}
+
+    size_t ruleCount() const { return rules.size(); }
+    size_t stateCount() const { return states.size(); }
+
+    vector<RuleViolation> run(const vector<pair<string, string>>& lexicalUnits, const string& language,
+                              const AnalysisBudget* budget = nullptr, size_t* processed = nullptr) const {
+        struct Obligation {
+            int rule;
+            int line;
+        };
+        vector<RuleViolation> violations;
+        vector<Obligation> open;
+        int state = 0;
+        int line = 1;
+        int tokenInLine = 0;
+        size_t steps = 0;
+        if (processed) *processed = lexicalUnits.size();
+
+        auto settle = [&](int symbol, bool terminate) {
+            size_t kept = 0;
+            for (const auto& obligation : open) {
+                if (requiredSymbol[obligation.rule] == symbol) continue;
+                if (terminate && terminatorSymbol[obligation.rule] == symbol) {
+                    const TokenRule& rule = rules[obligation.rule];
+                    violations.push_back({obligation.line, rule.id, rule.message});
+                    continue;
+                }
+                open[kept++] = obligation;
+            }
+            open.resize(kept);
+        };
+
+        for (const auto& [token, type] : lexicalUnits) {
+            if (budgetExceeded(budget, ++steps)) {
+                if (processed) *processed = steps - 1;
+                return violations; // Open obligations are undecided, not violations
+            }
+            if (type == "comment") {
+                line += count(token.begin(), token.end(), '\n');
+                continue;
+            }
+
+            bool literal = type == "string_literal" || type == "numeric_literal";
+            int symbol = literal ? -1 : lookupSymbol(token);
+            if (symbol >= 0 && !open.empty() && (isRequired[symbol] || isTerminator[symbol]))
+                settle(symbol, isTerminator[symbol]);
+
+            if (token == "NEWLINE" && type == "separator") {
+                line++;
+                tokenInLine = 0;
+                state = 0; // Patterns never span lines
+                continue;
+            }
+            if (literal) line += count(token.begin(), token.end(), '\n');
+
+            state = step(state, symbol);
+            for (int r : states[state].matches) {
+                const TokenRule& rule = rules[r];
+                if (rule.language != "*" && rule.language != language) continue;
+                if (rule.anchored && tokenInLine + 1 != (int)rule.pattern.size()) continue;
+                open.push_back({r, line});
+            }
+            tokenInLine++;
+        }
+
+        // End of input terminates every open obligation
+        for (const auto& obligation : open) {
+            const TokenRule& rule = rules[obligation.rule];
+            violations.push_back({obligation.line, rule.id, rule.message});
+        }
+        return violations;
+    }
+};
 
 // Add these helper functions
 void printLexicalAnalysisResults(const vector<pair<string, string>>& lexicalUnits) {
@@ -713,54 +1496,781 @@ void printLexicalAnalysisResults(const vector<pair<string, string>>& lexicalUnit
     }
 }
 
-void printTokenStatistics(const vector<pair<string, string>>& lexicalUnits) {
-    cout << "\nToken Statistics:\n";
-    cout << "================\n";
-    map<string, int> tokenTypes;
-    for (const auto& unit : lexicalUnits) {
-        tokenTypes[unit.second]++;
+// Reads a whole source file into memory
+bool readSourceFile(const string& path, string& contents) {
+    ifstream fin(path, ios::binary);
+    if (!fin.is_open()) return false;
+    stringstream buffer;
+    buffer << fin.rdbuf();
+    contents = buffer.str();
+    return true;
+}
+
+// Token-stream fingerprinting for near-duplicate / plagiarism detection
+// Identifiers and literals are replaced by placeholders and comments are dropped, so
+// renaming variables or changing constants does not hide a copied submission.
+const int FINGERPRINT_KGRAM = 5;                         // Tokens per k-gram
+const int FINGERPRINT_WINDOW = 4;                        // Winnowing window (in k-grams)
+const int MINHASH_SIZE = 128;                            // Signature length
+const int LSH_BANDS = 32;                                // Bands x rows = signature length
+const int LSH_ROWS = MINHASH_SIZE / LSH_BANDS;
+
+struct Fingerprint {
+    string name;
+    vector<uint64_t> hashes;                 // Winnowed k-gram hashes (sorted, unique)
+    array<uint32_t, MINHASH_SIZE> signature; // MinHash signature over the winnowed set
+};
+
+// 64-bit FNV-1a hash
+uint64_t hashBytes(const string& text, uint64_t seed = 1469598103934665603ULL) {
+    uint64_t h = seed;
+    for (unsigned char c : text) {
+        h ^= c;
+        h *= 1099511628211ULL;
     }
-    
-    // Print statistics with comments included
-    for (const auto& [type, count] : tokenTypes) {
-        cout << type << ": " << count;
-        if (type == "comment") {
-            cout << " (Removed during analysis)";
+    return h;
+}
+
+class TokenFingerprinter {
+    // Coefficients of the MinHash permutations, laid out as flat arrays so the
+    // per-hash update loop below compiles to straight SIMD code
+    alignas(64) uint32_t minhashA[MINHASH_SIZE];
+    alignas(64) uint32_t minhashB[MINHASH_SIZE];
+
+public:
+    TokenFingerprinter() {
+        mt19937 rng(0x5eed);
+        for (int j = 0; j < MINHASH_SIZE; j++) {
+            minhashA[j] = rng() | 1u; // Odd multipliers are bijective mod 2^32
+            minhashB[j] = rng();
         }
-        cout << endl;
     }
-}
 
-// Add queue for error tracking
-queue<string> errorQueue;
-unordered_map<char, char> matchingBrackets = {{')', '('}, {'}', '{'}, {']', '['}};
+    // Maps a lexical unit to the hash of its normalized form (0 = dropped)
+    static uint64_t normalizedTokenHash(const pair<string, string>& unit) {
+        const string& type = unit.second;
+        if (type == "comment" || unit.first == "NEWLINE") return 0;
+        if (type == "identifier" || type == "invalid_identifier" || type == "unknown")
+            return hashBytes("ID");
+        if (type == "string_literal" || type == "numeric_literal")
+            return hashBytes("LIT");
+        return hashBytes(unit.first);
+    }
 
-// Add error logging function
-void logError(const string& error) {
-    errorQueue.push(error);
-}
+    Fingerprint fingerprint(const string& name, const vector<pair<string, string>>& lexicalUnits) const {
+        Fingerprint fp;
+        fp.name = name;
+        fp.signature.fill(UINT32_MAX);
 
-// Modify the main function to include the additional checks
-int main() {
-    // Initialize analyzers
-    LexicalAnalyzer lexAnalyzer;
-    LanguageDetector langDetector;
-    
-    // Read input file
-    ifstream fin("lexicalinput.txt");
-    if (!fin.is_open()) {
-        cout << "Error opening file\n";
+        // Rolling polynomial hash over k consecutive normalized tokens
+        const uint64_t base = 1000003ULL;
+        uint64_t basePow = 1;
+        for (int k = 1; k < FINGERPRINT_KGRAM; k++) basePow *= base;
+
+        uint64_t window[FINGERPRINT_KGRAM] = {};
+        vector<uint64_t> kgrams;
+        uint64_t rolling = 0;
+        size_t seen = 0;
+        for (const auto& unit : lexicalUnits) {
+            uint64_t h = normalizedTokenHash(unit);
+            if (h == 0) continue;
+            uint64_t& slot = window[seen % FINGERPRINT_KGRAM];
+            if (seen >= (size_t)FINGERPRINT_KGRAM) rolling -= slot * basePow;
+            slot = h;
+            rolling = rolling * base + h;
+            if (++seen >= (size_t)FINGERPRINT_KGRAM) kgrams.push_back(rolling);
+        }
+
+        // Winnowing: keep the rightmost minimum of every window of k-gram hashes
+        deque<size_t> candidates;
+        long long lastPicked = -1;
+        for (size_t i = 0; i < kgrams.size(); i++) {
+            while (!candidates.empty() && kgrams[candidates.back()] >= kgrams[i])
+                candidates.pop_back();
+            candidates.push_back(i);
+            if (candidates.front() + FINGERPRINT_WINDOW <= i)
+                candidates.pop_front();
+            if (i + 1 >= (size_t)FINGERPRINT_WINDOW) {
+                if ((long long)candidates.front() != lastPicked) {
+                    lastPicked = candidates.front();
+                    fp.hashes.push_back(kgrams[candidates.front()]);
+                }
+            }
+        }
+        // Snippets shorter than one window still get their k-grams recorded
+        if (kgrams.size() < (size_t)FINGERPRINT_WINDOW)
+            fp.hashes = kgrams;
+
+        sort(fp.hashes.begin(), fp.hashes.end());
+        fp.hashes.erase(unique(fp.hashes.begin(), fp.hashes.end()), fp.hashes.end());
+
+        // MinHash: one multiply-add-shift per permutation, no branches in the inner loop
+        alignas(64) uint32_t sig[MINHASH_SIZE];
+        fill(sig, sig + MINHASH_SIZE, UINT32_MAX);
+        for (uint64_t h : fp.hashes) {
+            uint32_t x = (uint32_t)(h ^ (h >> 32));
+            for (int j = 0; j < MINHASH_SIZE; j++) {
+                uint32_t v = minhashA[j] * x + minhashB[j];
+                v ^= v >> 15;
+                sig[j] = v < sig[j] ? v : sig[j];
+            }
+        }
+        copy(sig, sig + MINHASH_SIZE, fp.signature.begin());
+        return fp;
+    }
+};
+
+// Estimated Jaccard similarity between two MinHash signatures
+double estimateSimilarity(const Fingerprint& a, const Fingerprint& b) {
+    int equal = 0;
+    for (int j = 0; j < MINHASH_SIZE; j++)
+        equal += a.signature[j] == b.signature[j];
+    return (double)equal / MINHASH_SIZE;
+}
+
+int defaultThreadCount() {
+    unsigned int n = thread::hardware_concurrency();
+    return n == 0 ? 2 : (int)n;
+}
+
+// Runs worker on threadCount threads, the calling thread included, and waits for all of them
+template <typename Worker>
+void runWorkers(Worker& worker, int threadCount) {
+    vector<thread> threads;
+    for (int t = 1; t < threadCount; t++) threads.emplace_back(worker);
+    worker();
+    for (auto& th : threads) th.join();
+}
+
+// Locality-sensitive hash index over MinHash signatures
+// Each band of LSH_ROWS signature values is hashed into its own bucket table; two
+// snippets become candidates when any band collides, so queries never scan the corpus.
+class FingerprintIndex {
+    vector<Fingerprint> entries;
+    vector<unordered_map<uint64_t, vector<int>>> bands;
+
+    static uint64_t bandKey(const Fingerprint& fp, int band) {
+        uint64_t h = 1469598103934665603ULL;
+        for (int r = 0; r < LSH_ROWS; r++) {
+            h ^= fp.signature[band * LSH_ROWS + r];
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+
+public:
+    FingerprintIndex() : bands(LSH_BANDS) {}
+
+    // Fingerprints all files in parallel, then fills the band tables in parallel
+    // (each thread owns a disjoint set of bands, so no locking is needed)
+    void build(const vector<string>& paths, int threadCount) {
+        entries.assign(paths.size(), Fingerprint());
+        atomic<size_t> nextFile(0);
+        auto fingerprintWorker = [&]() {
+            LexicalAnalyzer analyzer;
+            TokenFingerprinter fingerprinter;
+            for (size_t i = nextFile++; i < paths.size(); i = nextFile++) {
+                string code;
+                if (!readSourceFile(paths[i], code)) {
+                    entries[i].name = paths[i];
+                    entries[i].signature.fill(UINT32_MAX);
+                    continue;
+                }
+                entries[i] = fingerprinter.fingerprint(paths[i], analyzer.analyzeLexically(code));
+            }
+        };
+        runWorkers(fingerprintWorker, threadCount);
+
+        atomic<int> nextBand(0);
+        auto bandWorker = [&]() {
+            for (int band = nextBand++; band < LSH_BANDS; band = nextBand++) {
+                for (int i = 0; i < (int)entries.size(); i++) {
+                    if (entries[i].hashes.empty()) continue;
+                    bands[band][bandKey(entries[i], band)].push_back(i);
+                }
+            }
+        };
+        runWorkers(bandWorker, threadCount);
+    }
+
+    // Returns corpus entries whose estimated similarity to the query reaches the threshold
+    vector<pair<int, double>> query(const Fingerprint& fp, double threshold) const {
+        vector<int> candidates;
+        if (fp.hashes.empty()) return {};
+        for (int band = 0; band < LSH_BANDS; band++) {
+            auto it = bands[band].find(bandKey(fp, band));
+            if (it != bands[band].end())
+                candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+        }
+        sort(candidates.begin(), candidates.end());
+        candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+
+        vector<pair<int, double>> matches;
+        for (int id : candidates) {
+            double similarity = estimateSimilarity(fp, entries[id]);
+            if (similarity >= threshold) matches.push_back({id, similarity});
+        }
+        sort(matches.begin(), matches.end(),
+             [](const pair<int, double>& a, const pair<int, double>& b) { return a.second > b.second; });
+        return matches;
+    }
+
+    const vector<Fingerprint>& getEntries() const {
+        return entries;
+    }
+};
+
+// Command-line numbers are parsed strictly, so a typo is a usage error rather than an
+// uncaught exception: false on empty text, trailing garbage or a value out of range
+bool parseDoubleArg(const string& text, double& value, double low, double high) {
+    char* end = nullptr;
+    errno = 0;
+    value = strtod(text.c_str(), &end);
+    return !text.empty() && *end == '\0' && errno == 0 && value >= low && value <= high;
+}
+
+bool parseUnsignedArg(const string& text, uint64_t& value, uint64_t high = UINT64_MAX) {
+    char* end = nullptr;
+    errno = 0;
+    value = strtoull(text.c_str(), &end, 10);
+    return !text.empty() && isdigit((unsigned char)text[0]) && *end == '\0' && errno == 0 && value <= high;
+}
+
+// --fingerprint <files...>             report near-duplicate pairs within the corpus
+// --match <snippet> <corpus files...>  report corpus files similar to one snippet
+int runFingerprintMode(const vector<string>& args) {
+    double threshold = 0.5;
+    bool validThreshold = true;
+    vector<string> files;
+    for (size_t i = 1; i < args.size(); i++) {
+        if (args[i] == "--threshold")
+            validThreshold = validThreshold && i + 1 < args.size() && parseDoubleArg(args[++i], threshold, 0, 1);
+        else files.push_back(args[i]);
+    }
+    bool matchMode = args[0] == "--match";
+    if (!validThreshold || files.empty() || (matchMode && files.size() < 2)) {
+        cout << "Usage: " << args[0] << (matchMode ? " <snippet>" : "")
+             << " <files...> [--threshold 0..1, default 0.5]\n";
         return 1;
     }
-    
-    stringstream buffer;
-    buffer << fin.rdbuf();
-    string code = buffer.str();
-    fin.close();
-    
-    auto lexicalUnits = lexAnalyzer.analyzeLexically(code);
-    string detectedLanguage = langDetector.detectLanguage(lexicalUnits);
-    
+
+    string queryPath;
+    if (matchMode) {
+        queryPath = files.front();
+        files.erase(files.begin());
+    }
+
+    FingerprintIndex index;
+    index.build(files, defaultThreadCount());
+    const auto& entries = index.getEntries();
+
+    cout << "Near-Duplicate Analysis:\n";
+    cout << "------------------------\n";
+    cout << "Files indexed: " << entries.size() << "\n";
+
+    bool found = false;
+    if (matchMode) {
+        string code;
+        if (!readSourceFile(queryPath, code)) {
+            cout << "Error opening file " << queryPath << "\n";
+            return 1;
+        }
+        LexicalAnalyzer analyzer;
+        Fingerprint fp = TokenFingerprinter().fingerprint(queryPath, analyzer.analyzeLexically(code));
+        for (const auto& [id, similarity] : index.query(fp, threshold)) {
+            found = true;
+            cout << "- " << entries[id].name << ": " << (int)round(similarity * 100) << "% similar\n";
+        }
+    } else {
+        for (int i = 0; i < (int)entries.size(); i++) {
+            for (const auto& [id, similarity] : index.query(entries[i], threshold)) {
+                if (id <= i) continue;
+                found = true;
+                cout << "- " << entries[i].name << " <-> " << entries[id].name << ": "
+                     << (int)round(similarity * 100) << "% similar\n";
+            }
+        }
+    }
+    if (!found) cout << "No near-duplicates above " << (int)round(threshold * 100) << "% found\n";
+    return 0;
+}
+
+vector<string> splitLines(const string& code) {
+    vector<string> lines;
+    istringstream iss(code);
+    string line;
+    while (getline(iss, line)) lines.push_back(line);
+    return lines;
+}
+
+// Rules come from --rules <file>, else rules.txt in the current directory (where the
+// backend runs the analyzer), else rules.txt next to the executable. rules.txt is the only
+// copy of the default rules; when none can be read the run says so and checks no rules.
+vector<TokenRule> loadRulesForRun(const vector<string>& args) {
+    vector<string> candidates = {"rules.txt"};
+    for (size_t i = 0; i + 1 < args.size(); i++) {
+        if (args[i] == "--rules") candidates = {args[i + 1]};
+    }
+    if (candidates.size() == 1 && candidates[0] == "rules.txt") {
+        error_code ec;
+        filesystem::path executable = filesystem::read_symlink("/proc/self/exe", ec);
+        if (!ec) candidates.push_back((executable.parent_path() / "rules.txt").string());
+    }
+    for (const string& path : candidates) {
+        ifstream fin(path);
+        if (fin.is_open()) return loadTokenRules(fin);
+    }
+    cout << "Warning: cannot open rules file " << candidates[0] << "; no token rules are checked\n";
+    return {};
+}
+
+// --bench-rules [file]: time one automaton pass over ~1M tokens with 10..1000 active rules.
+// Each rule set is timed twice: with patterns drawn from tokens that never occur (the cost
+// of stepping the automaton alone) and from the stream's identifiers, where the cost of
+// matches and reported violations comes on top
+int runRuleBenchmark(const vector<string>& args) {
+    mt19937 rng(42);
+    const int vocabulary = 5000;
+    vector<pair<string, string>> units;
+    if (args.size() > 1) {
+        string code;
+        if (!readSourceFile(args[1], code)) {
+            cout << "Error opening file " << args[1] << "\n";
+            return 1;
+        }
+        LexicalAnalyzer analyzer;
+        auto fileUnits = analyzer.analyzeLexically(code);
+        while (!fileUnits.empty() && units.size() < 1000000)
+            units.insert(units.end(), fileUnits.begin(), fileUnits.end());
+    } else {
+        // Synthetic statements: a few identifiers, usually closed by ';'
+        while (units.size() < 1000000) {
+            int length = 2 + rng() % 8;
+            for (int t = 0; t < length; t++)
+                units.push_back({"id" + to_string(rng() % vocabulary), "identifier"});
+            if (rng() % 4) units.push_back({";", "separator"});
+            units.push_back({"NEWLINE", "separator"});
+        }
+    }
+
+    // Identifiers of the stream, for patterns that can match
+    vector<string> identifiers;
+    for (const auto& unit : units) {
+        if (unit.second == "identifier") identifiers.push_back(unit.first);
+    }
+    sort(identifiers.begin(), identifiers.end());
+    identifiers.erase(unique(identifiers.begin(), identifiers.end()), identifiers.end());
+    if (identifiers.empty()) identifiers.push_back("id0");
+
+    auto makeRules = [&](int ruleCount, bool matchable) {
+        vector<TokenRule> rules;
+        for (int r = 0; r < ruleCount; r++) {
+            TokenRule rule;
+            rule.id = "bench-" + to_string(r);
+            rule.language = "*";
+            int length = 1 + r % 3;
+            for (int t = 0; t < length; t++)
+                rule.pattern.push_back(matchable ? identifiers[rng() % identifiers.size()]
+                                                 : "absent" + to_string(rng() % vocabulary));
+            rule.required = ";";
+            rule.terminator = "NEWLINE";
+            rule.message = "Missing semicolon";
+            rules.push_back(rule);
+        }
+        return rules;
+    };
+    // Nanoseconds per token of one pass, averaged over a few rounds
+    auto timePass = [&](const RuleAutomaton& automaton, size_t& violations) {
+        const int rounds = 5;
+        violations = 0;
+        auto start = chrono::steady_clock::now();
+        for (int round = 0; round < rounds; round++)
+            violations += automaton.run(units, "C++").size();
+        violations /= rounds;
+        return chrono::duration<double>(chrono::steady_clock::now() - start).count() / rounds * 1e9 / units.size();
+    };
+
+    cout << "Rule Engine Benchmark (" << units.size() << " tokens):\n";
+    cout << "------------------------------------------\n";
+    for (int ruleCount : {10, 100, 1000}) {
+        RuleAutomaton idle(makeRules(ruleCount, false));
+        RuleAutomaton matching(makeRules(ruleCount, true));
+        size_t idleViolations, violations;
+        double scanCost = timePass(idle, idleViolations);
+        double matchCost = timePass(matching, violations);
+
+        cout << setw(5) << right << ruleCount << " rules: " << fixed << setprecision(2) << scanCost
+             << " ns/token scanning, " << matchCost << " ns/token with " << violations << " violations ("
+             << matching.stateCount() << " states)\n";
+    }
+    return 0;
+}
+
+// Streaming corpus statistics
+// Every structure below has a fixed memory footprint and merges by addition (or max),
+// so per-thread and per-file results combine into the same answer as one long pass.
+
+// Finalizer that spreads FNV output over all 64 bits (splitmix64)
+uint64_t mixHash(uint64_t h) {
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+// Count-min sketch: frequency estimates that never undercount
+class CountMinSketch {
+    static const int DEPTH = 4;
+    static const int WIDTH = 1 << 14;
+    vector<uint64_t> counters;
+
+    static size_t slot(uint64_t h, int row) {
+        uint32_t h1 = (uint32_t)h, h2 = (uint32_t)(h >> 32) | 1u;
+        return (size_t)row * WIDTH + ((h1 + (uint32_t)row * h2) & (WIDTH - 1));
+    }
+
+public:
+    CountMinSketch() : counters((size_t)DEPTH * WIDTH, 0) {}
+
+    // Adds a key and returns its new estimated count
+    uint64_t add(const string& key, uint64_t count = 1) {
+        uint64_t h = mixHash(hashBytes(key));
+        uint64_t estimate = UINT64_MAX;
+        for (int row = 0; row < DEPTH; row++) {
+            uint64_t& counter = counters[slot(h, row)];
+            counter += count;
+            estimate = min(estimate, counter);
+        }
+        return estimate;
+    }
+
+    uint64_t estimate(const string& key) const {
+        uint64_t h = mixHash(hashBytes(key));
+        uint64_t estimate = UINT64_MAX;
+        for (int row = 0; row < DEPTH; row++) estimate = min(estimate, counters[slot(h, row)]);
+        return estimate;
+    }
+
+    void merge(const CountMinSketch& other) {
+        for (size_t i = 0; i < counters.size(); i++) counters[i] += other.counters[i];
+    }
+};
+
+// Top-k heavy hitters: a count-min sketch plus a bounded min-heap of candidates
+// (kept as an ordered set so a candidate's count can be raised in place)
+class TopKTracker {
+    size_t capacity;
+    CountMinSketch sketch;
+    unordered_map<string, uint64_t> candidates;
+    set<pair<uint64_t, string>> heap;
+
+    void offer(const string& key, uint64_t estimate) {
+        auto it = candidates.find(key);
+        if (it != candidates.end()) {
+            heap.erase({it->second, key});
+            it->second = estimate;
+            heap.insert({estimate, key});
+            return;
+        }
+        if (candidates.size() >= capacity) {
+            if (estimate <= heap.begin()->first) return;
+            candidates.erase(heap.begin()->second);
+            heap.erase(heap.begin());
+        }
+        candidates[key] = estimate;
+        heap.insert({estimate, key});
+    }
+
+public:
+    explicit TopKTracker(size_t k) : capacity(k) {}
+
+    void add(const string& key) {
+        offer(key, sketch.add(key));
+    }
+
+    void merge(const TopKTracker& other) {
+        sketch.merge(other.sketch);
+        vector<string> keys;
+        for (const auto& [key, count] : candidates) keys.push_back(key);
+        for (const auto& [key, count] : other.candidates) keys.push_back(key);
+        candidates.clear();
+        heap.clear();
+        for (const string& key : keys) {
+            if (!candidates.count(key)) offer(key, sketch.estimate(key));
+        }
+    }
+
+    // Heavy hitters, most frequent first
+    vector<pair<string, uint64_t>> top() const {
+        vector<pair<string, uint64_t>> result;
+        for (auto it = heap.rbegin(); it != heap.rend(); ++it) result.push_back({it->second, it->first});
+        return result;
+    }
+};
+
+// HyperLogLog distinct counter (2^14 registers, ~0.8% standard error)
+class HyperLogLog {
+    static const int PRECISION = 14;
+    static const int REGISTERS = 1 << PRECISION;
+    vector<uint8_t> registers;
+
+public:
+    HyperLogLog() : registers(REGISTERS, 0) {}
+
+    void add(const string& key) {
+        uint64_t h = mixHash(hashBytes(key));
+        size_t index = h >> (64 - PRECISION);
+        uint64_t rest = (h << PRECISION) | (1ULL << (PRECISION - 1));
+        uint8_t rank = __builtin_clzll(rest) + 1;
+        registers[index] = max(registers[index], rank);
+    }
+
+    double estimate() const {
+        double sum = 0;
+        int zeros = 0;
+        for (uint8_t r : registers) {
+            sum += ldexp(1.0, -r);
+            zeros += r == 0;
+        }
+        double m = REGISTERS;
+        double estimate = 0.7213 / (1 + 1.079 / m) * m * m / sum;
+        if (estimate <= 2.5 * m && zeros > 0) estimate = m * log(m / zeros); // Small-range correction
+        return estimate;
+    }
+
+    void merge(const HyperLogLog& other) {
+        for (size_t i = 0; i < registers.size(); i++) registers[i] = max(registers[i], other.registers[i]);
+    }
+};
+
+struct CorpusStatistics {
+    uint64_t files = 0;
+    uint64_t bytes = 0;
+    array<uint64_t, TOKEN_KIND_COUNT> kindCounts{};
+    TopKTracker topIdentifiers{20};
+    TopKTracker topKeywords{20};
+    HyperLogLog distinctIdentifiers;
+
+    void addFile(const string& code, LexicalAnalyzer& analyzer) {
+        auto lexicalUnits = analyzer.analyzeLexically(code);
+        const auto& kinds = analyzer.getTokenKinds();
+        files++;
+        bytes += code.size();
+        for (size_t i = 0; i < lexicalUnits.size(); i++) {
+            kindCounts[kinds[i]]++;
+            if (kinds[i] == TOKEN_IDENTIFIER) {
+                topIdentifiers.add(lexicalUnits[i].first);
+                distinctIdentifiers.add(lexicalUnits[i].first);
+            } else if (kinds[i] == TOKEN_KEYWORD) {
+                topKeywords.add(lexicalUnits[i].first);
+            }
+        }
+    }
+
+    void merge(const CorpusStatistics& other) {
+        files += other.files;
+        bytes += other.bytes;
+        for (int k = 0; k < TOKEN_KIND_COUNT; k++) kindCounts[k] += other.kindCounts[k];
+        topIdentifiers.merge(other.topIdentifiers);
+        topKeywords.merge(other.topKeywords);
+        distinctIdentifiers.merge(other.distinctIdentifiers);
+    }
+};
+
+void printTokenStatistics(const CorpusStatistics& stats) {
+    cout << "\nToken Statistics:\n";
+    cout << "================\n";
+    cout << "Files: " << stats.files << " (" << stats.bytes << " bytes)\n";
+    for (int k = 0; k < TOKEN_KIND_COUNT; k++) {
+        if (stats.kindCounts[k] == 0) continue;
+        cout << TOKEN_KIND_NAMES[k] << ": " << stats.kindCounts[k] << "\n";
+    }
+    cout << "Distinct identifiers (estimated): " << llround(stats.distinctIdentifiers.estimate()) << "\n";
+
+    cout << "\nTop Identifiers:\n";
+    for (const auto& [name, count] : stats.topIdentifiers.top()) cout << "- " << name << ": ~" << count << "\n";
+    cout << "\nTop Keywords:\n";
+    for (const auto& [name, count] : stats.topKeywords.top()) cout << "- " << name << ": ~" << count << "\n";
+}
+
+bool isSourceFile(const filesystem::path& path) {
+    static const set<string> extensions = {".cpp", ".cc", ".cxx", ".c", ".h", ".hpp", ".java", ".py"};
+    return extensions.count(path.extension().string()) > 0;
+}
+
+// Expands directories (recursively) into the source files they contain
+vector<string> collectSourceFiles(const vector<string>& inputs) {
+    vector<string> files;
+    for (const string& input : inputs) {
+        error_code ec;
+        if (filesystem::is_directory(input, ec)) {
+            for (filesystem::recursive_directory_iterator it(input, ec), end; it != end; it.increment(ec)) {
+                if (ec) break;
+                if (it->is_regular_file(ec) && isSourceFile(it->path())) files.push_back(it->path().string());
+            }
+        } else {
+            files.push_back(input);
+        }
+    }
+    return files;
+}
+
+// --stats <files or directories...>: one streaming pass, one statistics object per thread
+int runStatisticsMode(const vector<string>& args) {
+    vector<string> files = collectSourceFiles(vector<string>(args.begin() + 1, args.end()));
+    if (files.empty()) {
+        cout << "Usage: --stats <files or directories...>\n";
+        return 1;
+    }
+
+    int threadCount = min<int>(defaultThreadCount(), files.size());
+    vector<CorpusStatistics> perThread(threadCount);
+    atomic<size_t> nextFile(0);
+    vector<thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([&, t]() {
+            LexicalAnalyzer analyzer;
+            string code;
+            for (size_t i = nextFile++; i < files.size(); i = nextFile++) {
+                if (readSourceFile(files[i], code)) perThread[t].addFile(code, analyzer);
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    for (int t = 1; t < threadCount; t++) perThread[0].merge(perThread[t]);
+    printTokenStatistics(perThread[0]);
+    return 0;
+}
+
+// Add queue for error tracking
+queue<string> errorQueue;
+unordered_map<char, char> matchingBrackets = {{')', '('}, {'}', '{'}, {']', '['}};
+
+// Add error logging function
+void logError(const string& error) {
+    errorQueue.push(error);
+}
+
+// Results of one analysis run; phases that ran out of budget are recorded in `phases`
+struct PhaseProgress {
+    string name;
+    size_t processed;
+    size_t total;
+    bool skipped = false; // The budget ran out before the phase could start
+    bool complete() const { return !skipped && processed >= total; }
+};
+
+struct AnalysisReport {
+    string language;
+    vector<pair<string, string>> lexicalUnits;
+    vector<TokenKind> tokenKinds;
+    vector<LexicalError> lexicalErrors;
+    vector<QuoteError> quoteErrors;
+    vector<BracketError> bracketErrors;
+    vector<string> indentationErrors;
+    vector<RuleViolation> ruleViolations;
+    StructuralIndex blocks; // Bracket tree, or indentation blocks for Python
+    vector<PhaseProgress> phases;
+    string stopReason;
+
+    bool isPartial() const {
+        return any_of(phases.begin(), phases.end(), [](const PhaseProgress& p) { return !p.complete(); });
+    }
+};
+
+const size_t DETECTION_PREFIX_BYTES = 4096;
+
+// Runs all phases cheapest-first, so an exhausted budget still leaves a language guess
+// and the byte-level checks: prefix detection, quotes, brackets, lexing, full detection,
+// then the indentation and rule checks that need tokens.
+// A detection engine, when given, replaces both trie detection passes.
+AnalysisReport runAnalysis(const string& code, LexicalAnalyzer& lexAnalyzer, LanguageDetector& langDetector,
+                           const RuleAutomaton& rules, const AnalysisBudget& budget,
+                           DetectionEngine* engine = nullptr) {
+    AnalysisReport report;
+
+    if (engine) {
+        report.language = engine->detect(code);
+        report.phases.push_back({"Language detection (" + engine->name() + ")", 1, 1});
+    } else {
+        // Language detection on a prefix always runs; it is bounded and cheap
+        size_t prefixLength = min(code.length(), DETECTION_PREFIX_BYTES);
+        while (prefixLength < code.length() && ((unsigned char)code[prefixLength] & 0xC0) == 0x80) prefixLength--;
+        report.language = langDetector.detectLanguage(lexAnalyzer.analyzeLexically(code.substr(0, prefixLength)));
+        report.phases.push_back({"Language detection (prefix)", 1, 1});
+    }
+
+    // A phase the budget keeps from starting is reported as skipped, even when it has no
+    // work (an empty file, or no tokens because lexing was skipped)
+    auto skip = [&](const string& name) { report.phases.push_back({name, 0, 0, true}); };
+
+    size_t processed = 0;
+    if (budget.exhausted()) {
+        skip("Quote balancing");
+    } else {
+        report.quoteErrors = checkQuotes(code, &budget, &processed, lexAnalyzer.isUtf8Mode());
+        report.phases.push_back({"Quote balancing", processed, code.length()});
+    }
+
+    processed = 0;
+    if (budget.exhausted()) {
+        skip("Bracket balancing");
+    } else {
+        report.bracketErrors = checkBrackets(code, report.language, &budget, &processed, lexAnalyzer.isUtf8Mode());
+        report.phases.push_back({"Bracket balancing", processed, code.length()});
+    }
+
+    if (budget.exhausted()) {
+        skip("Lexing");
+        if (!engine) skip("Language detection");
+    } else {
+        report.lexicalUnits = lexAnalyzer.analyzeLexically(code, &budget);
+        report.tokenKinds = lexAnalyzer.getTokenKinds();
+        report.lexicalErrors = lexAnalyzer.getLexicalErrors();
+        report.phases.push_back({"Lexing", lexAnalyzer.getLexedBytes(), code.length()});
+
+        if (!engine && budget.exhausted()) {
+            skip("Language detection");
+        } else if (!engine) {
+            bool complete = false;
+            string language = langDetector.detectLanguage(report.lexicalUnits, &budget, &complete);
+            report.phases.push_back({"Language detection", complete ? 1u : 0u, 1});
+            if (complete) report.language = language;
+        }
+        if (report.language != "Python")
+            indexBracketTokens(code, lexAnalyzer.getLexedBytes(), report.tokenKinds, lexAnalyzer.getTokenSpans(),
+                               report.blocks);
+    }
+
+    if (report.language == "Python") {
+        processed = 0;
+        if (budget.exhausted()) {
+            skip("Indentation checks");
+        } else {
+            report.indentationErrors = checkPythonIndentation(code, &budget, &processed, &report.blocks);
+            report.phases.push_back({"Indentation checks", processed, code.length()});
+        }
+    }
+
+    processed = 0;
+    if (budget.exhausted()) {
+        skip("Rule checks");
+    } else {
+        report.ruleViolations = rules.run(report.lexicalUnits, report.language, &budget, &processed);
+        report.phases.push_back({"Rule checks", processed, report.lexicalUnits.size()});
+    }
+
+    if (report.isPartial()) report.stopReason = budget.stopReason();
+    return report;
+}
+
+void printAnalysisReport(const AnalysisReport& report, const string& code) {
+    const string& detectedLanguage = report.language;
+    const auto& lexicalUnits = report.lexicalUnits;
+
     // 1. First show lexical analysis details
     cout << "Language Detected: " << detectedLanguage << "\n\n";
     
@@ -775,17 +2285,12 @@ int main() {
     // Show token statistics
     cout << "\nToken Statistics:\n";
     cout << "----------------\n";
-    int keywords = 0, identifiers = 0, operators = 0, literals = 0;
-    for (const auto& unit : lexicalUnits) {
-        if (unit.second == "keyword") keywords++;
-        else if (unit.second == "identifier") identifiers++;
-        else if (unit.second == "operator") operators++;
-        else if (unit.second == "string_literal" || unit.second == "numeric_literal") literals++;
-    }
-    cout << "Keywords: " << keywords << "\n";
-    cout << "Identifiers: " << identifiers << "\n";
-    cout << "Operators: " << operators << "\n";
-    cout << "Literals: " << literals << "\n";
+    array<uint64_t, TOKEN_KIND_COUNT> kindCounts{};
+    for (TokenKind kind : report.tokenKinds) kindCounts[kind]++;
+    cout << "Keywords: " << kindCounts[TOKEN_KEYWORD] << "\n";
+    cout << "Identifiers: " << kindCounts[TOKEN_IDENTIFIER] << "\n";
+    cout << "Operators: " << kindCounts[TOKEN_OPERATOR] << "\n";
+    cout << "Literals: " << kindCounts[TOKEN_STRING_LITERAL] + kindCounts[TOKEN_NUMERIC_LITERAL] << "\n";
 
     // 2. Then show any errors found
     cout << "\n=== ERROR ANALYSIS ===\n";
@@ -794,7 +2299,7 @@ int main() {
     bool hasErrors = false;
     
     // Check lexical errors
-    const auto& lexicalErrors = lexAnalyzer.getLexicalErrors();
+    const auto& lexicalErrors = report.lexicalErrors;
     if (!lexicalErrors.empty()) {
         hasErrors = true;
         cout << "\nLexical Errors Found:\n";
@@ -805,29 +2310,14 @@ int main() {
         }
     }
 
-    // Check syntax errors
-    vector<QuoteError> quoteErrors = checkQuotes(code);
-    vector<BracketError> bracketErrors = checkBrackets(code, detectedLanguage);
-    vector<string> indentationErrors;
-    vector<SemicolonError> semicolonErrors;
-
-    // Perform language-specific checks
-    if (detectedLanguage == "Python") {
-        indentationErrors = checkPythonIndentation(code);
-    } else {
-        istringstream iss(code);
-        string line;
-        int lineNumber = 0;
-        while (getline(iss, line)) {
-            lineNumber++;
-            auto errors = checkSemicolon(line, lineNumber, detectedLanguage);
-            semicolonErrors.insert(semicolonErrors.end(), errors.begin(), errors.end());
-        }
-    }
+    const auto& quoteErrors = report.quoteErrors;
+    const auto& bracketErrors = report.bracketErrors;
+    const auto& indentationErrors = report.indentationErrors;
+    const auto& ruleViolations = report.ruleViolations;
 
     // Show syntax errors if any
     if (!quoteErrors.empty() || !bracketErrors.empty() || 
-        !indentationErrors.empty() || !semicolonErrors.empty()) {
+        !indentationErrors.empty() || !ruleViolations.empty()) {
         hasErrors = true;
         cout << "\nSyntax Errors Found:\n";
         cout << "-----------------\n";
@@ -862,14 +2352,33 @@ int main() {
             }
         }
 
-        if (!semicolonErrors.empty()) {
-            cout << "\nMissing Semicolons:\n";
-            for (const auto& error : semicolonErrors) {
-                cout << "- Line " << error.line << ": " << error.lineContent << "\n";
+        if (!ruleViolations.empty()) {
+            vector<string> lines = splitLines(code);
+            cout << "\nRule Violations:\n";
+            for (const auto& violation : ruleViolations) {
+                cout << "- Line " << violation.line << ": " << violation.message
+                     << " (" << violation.ruleId << ")";
+                if (violation.line >= 1 && violation.line <= (int)lines.size())
+                    cout << ": " << lines[violation.line - 1];
+                cout << "\n";
             }
         }
     }
 
+    // 3. Say how far each phase got when the budget ran out
+    if (report.isPartial()) {
+        cout << "\n=== ANALYSIS STATUS ===\n";
+        cout << "Partial results (" << report.stopReason << "):\n";
+        for (const auto& phase : report.phases) {
+            cout << "- " << phase.name << ": ";
+            if (phase.skipped) cout << "skipped\n";
+            else if (phase.complete()) cout << "complete\n";
+            else cout << "stopped at " << (phase.total ? phase.processed * 100 / phase.total : 0) << "%\n";
+        }
+        if (!hasErrors) cout << "\nNo errors found in the analyzed portion.\n";
+        return;
+    }
+
     // If no errors found, show balanced message
     if (!hasErrors) {
         cout << "\nAll checks passed successfully!\n";
@@ -877,6 +2386,1897 @@ int main() {
         cout << "- Syntax analysis: All balanced\n";
         cout << "- Language-specific checks: Passed\n";
     }
+}
+
+// Builds the block index the same way runAnalysis does: indentation blocks for Python,
+// bracket tokens otherwise. The language is detected on the tokens unless given.
+string buildStructuralIndex(const string& code, StructuralIndex& index, string language = "") {
+    LexicalAnalyzer analyzer;
+    bool lexed = language.empty();
+    if (lexed) language = LanguageDetector().detectLanguage(analyzer.analyzeLexically(code));
+    if (language == "Python") {
+        checkPythonIndentation(code, nullptr, nullptr, &index);
+    } else {
+        if (!lexed) analyzer.analyzeLexically(code);
+        indexBracketTokens(code, code.size(), analyzer.getTokenKinds(), analyzer.getTokenSpans(), index);
+    }
+    return language;
+}
+
+void printBlock(const StructuralIndex& index, int id) {
+    if (id < 0) {
+        cout << "top level\n";
+        return;
+    }
+    const BlockNode& block = index.block(id);
+    cout << "'" << (block.kind == ':' ? string("block") : string(1, block.kind)) << "' "
+         << block.open << "-" << block.close << " (lines " << block.openLine << "-" << block.closeLine << ")\n";
+}
+
+// --blocks <file> enclosing <offset> | match <offset> | folding [firstLine lastLine]
+int runBlockQueryMode(const vector<string>& args) {
+    const char* usage = "Usage: --blocks <file> enclosing <offset> | match <offset> | folding [firstLine lastLine]\n";
+    string code;
+    if (args.size() < 3 || !readSourceFile(args[1], code)) {
+        cout << usage;
+        return 1;
+    }
+    const string& query = args[2];
+    uint64_t offset = 0, firstLine = 1, lastLine = INT_MAX;
+    bool valid;
+    if (query == "enclosing" || query == "match") {
+        valid = args.size() == 4 && parseUnsignedArg(args[3], offset);
+    } else if (query == "folding") {
+        valid = args.size() == 3 || (args.size() == 5 && parseUnsignedArg(args[3], firstLine, INT_MAX) &&
+                                     parseUnsignedArg(args[4], lastLine, INT_MAX) && firstLine >= 1);
+    } else {
+        cout << "Unknown block query '" << query << "'\n";
+        return 1;
+    }
+    if (!valid) {
+        cout << usage;
+        return 1;
+    }
+
+    StructuralIndex index;
+    buildStructuralIndex(code, index);
+    if (query == "enclosing") {
+        printBlock(index, index.enclosingBlock(offset));
+    } else if (query == "match") {
+        long long partner = index.matchingBracket(offset);
+        if (partner < 0) cout << "No bracket at offset " << offset << "\n";
+        else cout << partner << "\n";
+    } else {
+        for (const auto& block : index.foldingRanges(firstLine, lastLine))
+            cout << block.openLine << "-" << block.closeLine << "\n";
+    }
+    return 0;
+}
+
+// --bench-blocks [file]: index a large file, then time 1M random offset queries
+int runBlockBenchmark(const vector<string>& args) {
+    string seed;
+    if (args.size() > 1) {
+        if (!readSourceFile(args[1], seed)) {
+            cout << "Error opening file " << args[1] << "\n";
+            return 1;
+        }
+    } else {
+        seed = "std::vector<int> f(const std::vector<int>& x) {\n    if (!x.empty()) {\n"
+               "        return g(x[0], {1, 2});\n    }\n    return {};\n}\n";
+    }
+    // Detected once on the seed, the actual input, rather than on the repeated file
+    LexicalAnalyzer seedLexer;
+    string language = LanguageDetector().detectLanguage(seedLexer.analyzeLexically(seed));
+    // The index build lexes the whole file, so it is kept at a size whose tokens fit in memory
+    string code;
+    while (!seed.empty() && code.size() < (16u << 20)) code += seed;
+
+    StructuralIndex index;
+    auto start = chrono::steady_clock::now();
+    buildStructuralIndex(code, index, language);
+    double buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    mt19937_64 rng(7);
+    const int queries = 1000000;
+    vector<size_t> offsets(queries);
+    for (auto& offset : offsets) offset = rng() % code.size();
+
+    long long checksum = 0;
+    start = chrono::steady_clock::now();
+    for (size_t offset : offsets) checksum += index.enclosingBlock(offset);
+    double enclosingSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    for (size_t offset : offsets) checksum += index.matchingBracket(offset);
+    double matchSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "Block Index Benchmark:\n";
+    cout << "----------------------\n";
+    cout << "File: " << code.size() / (1 << 20) << " MB (" << language << "), " << index.size() << " blocks\n";
+    cout << fixed << setprecision(1);
+    cout << "Index build (" << (language == "Python" ? "indentation scan" : "lexing + bracket tokens") << "): "
+         << buildSeconds * 1000 << " ms\n";
+    cout << "Enclosing block x" << queries << ": " << enclosingSeconds * 1000 << " ms ("
+         << enclosingSeconds * 1e9 / queries << " ns/query)\n";
+    cout << "Matching bracket x" << queries << ": " << matchSeconds * 1000 << " ms ("
+         << matchSeconds * 1e9 / queries << " ns/query)\n";
+    cout << "Checksum: " << checksum << "\n";
+    return 0;
+}
+
+// Semantic tokens for editor highlighting
+// LSP-style encoding: five integers per token (delta line, delta start column, length,
+// kind, modifier bits), with line and column relative to the previous token. Kind ids
+// index TOKEN_KIND_NAMES and modifier bits index SEMANTIC_MODIFIER_NAMES; together they
+// form the legend, sent with full-file requests only.
+
+enum SemanticModifier {
+    MODIFIER_DOCUMENTATION = 1 << 0, // "/**" and "///" comments
+    MODIFIER_UNTERMINATED = 1 << 1,  // String or block comment running to the end of input
+};
+
+const char* const SEMANTIC_MODIFIER_NAMES[] = {"documentation", "unterminated"};
+
+class SemanticTokenEncoder {
+    const string& code;
+    bool utf8;
+    vector<size_t> lineStarts;
+
+    // Cached column of the last position on the current line, so a line with many
+    // tokens is scanned once instead of once per token
+    size_t cachedLine = SIZE_MAX, cachedOffset = 0, cachedColumn = 0;
+
+    size_t countColumns(size_t from, size_t to) const {
+        if (!utf8) return to - from;
+        size_t columns = 0;
+        for (size_t k = from; k < to; k++) columns += ((unsigned char)code[k] & 0xC0) != 0x80;
+        return columns;
+    }
+
+    size_t columnOf(size_t line, size_t offset) {
+        if (line != cachedLine || offset < cachedOffset) {
+            cachedLine = line;
+            cachedOffset = lineStarts[line];
+            cachedColumn = 0;
+        }
+        cachedColumn += countColumns(cachedOffset, offset);
+        cachedOffset = offset;
+        return cachedColumn;
+    }
+
+    unsigned modifiersOf(TokenKind kind, const TokenSpan& span) const {
+        size_t end = span.offset + span.length;
+        char first = code[span.offset];
+        if (kind == TOKEN_COMMENT) {
+            unsigned modifiers = 0;
+            if (code.compare(span.offset, 3, "/**") == 0 || code.compare(span.offset, 3, "///") == 0)
+                modifiers |= MODIFIER_DOCUMENTATION;
+            if (first == '/' && code[span.offset + 1] == '*' &&
+                (span.length < 4 || code.compare(end - 2, 2, "*/") != 0))
+                modifiers |= MODIFIER_UNTERMINATED;
+            return modifiers;
+        }
+        if (kind == TOKEN_STRING_LITERAL && end == code.size() && (span.length < 2 || code[end - 1] != first))
+            return MODIFIER_UNTERMINATED;
+        return 0;
+    }
+
+public:
+    SemanticTokenEncoder(const string& source, bool utf8Columns) : code(source), utf8(utf8Columns) {
+        lineStarts.assign(1, 0);
+        for (size_t i = 0; i < code.length(); i++) {
+            if (code[i] == '\n') lineStarts.push_back(i + 1);
+        }
+    }
+
+    size_t lineCount() const {
+        return lineStarts.size();
+    }
+
+    // Encodes the tokens touching lines [firstLine, lastLine] (1-based, inclusive).
+    // Tokens spanning lines are split into one entry per line, as LSP clients expect.
+    vector<uint32_t> encode(const vector<TokenKind>& kinds, const vector<TokenSpan>& spans,
+                            size_t firstLine, size_t lastLine) {
+        vector<uint32_t> data;
+        if (firstLine < 1 || firstLine > lastLine || firstLine > lineStarts.size()) return data;
+        size_t rangeStart = lineStarts[firstLine - 1];
+        size_t rangeEnd = lastLine < lineStarts.size() ? lineStarts[lastLine] : code.size();
+
+        // Spans are emitted in source order and never overlap, so their ends are sorted too
+        size_t first = partition_point(spans.begin(), spans.end(), [&](const TokenSpan& span) {
+            return span.offset + span.length <= rangeStart;
+        }) - spans.begin();
+
+        size_t line = upper_bound(lineStarts.begin(), lineStarts.end(), rangeStart) - lineStarts.begin() - 1;
+        size_t previousLine = 0, previousColumn = 0;
+        for (size_t t = first; t < spans.size() && spans[t].offset < rangeEnd; t++) {
+            const TokenSpan& span = spans[t];
+            if (span.length == 0 || code[span.offset] == '\n') continue; // NEWLINE units
+            unsigned modifiers = modifiersOf(kinds[t], span);
+
+            size_t pieceStart = max(span.offset, rangeStart);
+            size_t tokenEnd = min(span.offset + span.length, rangeEnd);
+            while (pieceStart < tokenEnd) {
+                while (line + 1 < lineStarts.size() && lineStarts[line + 1] <= pieceStart) line++;
+                size_t lineEnd = line + 1 < lineStarts.size() ? lineStarts[line + 1] - 1 : code.size();
+                size_t pieceEnd = min(tokenEnd, lineEnd);
+                if (pieceEnd > pieceStart) {
+                    size_t column = columnOf(line, pieceStart);
+                    data.push_back(line - previousLine);
+                    data.push_back(line == previousLine ? column - previousColumn : column);
+                    data.push_back(countColumns(pieceStart, pieceEnd));
+                    data.push_back(kinds[t]);
+                    data.push_back(modifiers);
+                    previousLine = line;
+                    previousColumn = column;
+                }
+                pieceStart = pieceEnd + 1; // Skip the line break
+            }
+        }
+        return data;
+    }
+};
+
+void appendJsonIntegers(string& out, const vector<uint32_t>& values) {
+    char buffer[16];
+    out += '[';
+    for (size_t i = 0; i < values.size(); i++) {
+        if (i) out += ',';
+        out.append(buffer, to_chars(buffer, buffer + sizeof(buffer), values[i]).ptr);
+    }
+    out += ']';
+}
+
+// --semantic-tokens <file> [firstLine lastLine]: highlighting data as JSON. A full-file
+// request carries the legend; a line-range request (the editor viewport) only the data.
+int runSemanticTokensMode(const vector<string>& args) {
+    const char* usage = "Usage: --semantic-tokens <file> [firstLine lastLine] [--ascii]\n";
+    string code;
+    if (args.size() < 2 || !readSourceFile(args[1], code)) {
+        cout << usage;
+        return 1;
+    }
+    bool utf8 = find(args.begin(), args.end(), "--ascii") == args.end();
+    vector<string> range;
+    for (size_t i = 2; i < args.size(); i++) {
+        if (args[i] != "--ascii") range.push_back(args[i]);
+    }
+    bool ranged = !range.empty();
+    uint64_t firstLine = 1, lastLine = 0;
+    if (ranged && !(range.size() == 2 && parseUnsignedArg(range[0], firstLine) &&
+                    parseUnsignedArg(range[1], lastLine) && firstLine >= 1 && firstLine <= lastLine)) {
+        cout << usage;
+        return 1;
+    }
+
+    LexicalAnalyzer lexer;
+    lexer.setUtf8Mode(utf8);
+    lexer.analyzeLexically(code);
+    SemanticTokenEncoder encoder(code, utf8);
+    if (!ranged) lastLine = encoder.lineCount();
+
+    string out = "{";
+    if (!ranged) {
+        out += "\"legend\":{\"tokenTypes\":[";
+        for (int kind = 0; kind < TOKEN_KIND_COUNT; kind++)
+            out += string(kind ? "," : "") + "\"" + TOKEN_KIND_NAMES[kind] + "\"";
+        out += "],\"tokenModifiers\":[";
+        for (size_t bit = 0; bit < size(SEMANTIC_MODIFIER_NAMES); bit++)
+            out += string(bit ? "," : "") + "\"" + SEMANTIC_MODIFIER_NAMES[bit] + "\"";
+        // Columns and lengths count code points (bytes with --ascii)
+        out += string("]},\"positionEncoding\":\"") + (utf8 ? "utf-32" : "utf-8") + "\",";
+    }
+    out += "\"data\":";
+    appendJsonIntegers(out, encoder.encode(lexer.getTokenKinds(), lexer.getTokenSpans(), firstLine, lastLine));
+    out += "}\n";
+    cout << out;
+    return 0;
+}
+
+// Reads <dir>/<Language>/... into (language, path) pairs; directory names are the labels
+vector<pair<string, string>> collectLabeledFiles(const string& root) {
+    vector<pair<string, string>> labeled;
+    error_code ec;
+    for (const auto& entry : filesystem::directory_iterator(root, ec)) {
+        if (!entry.is_directory()) continue;
+        string language = entry.path().filename().string();
+        for (const string& file : collectSourceFiles({entry.path().string()}))
+            labeled.push_back({language, file});
+    }
+    sort(labeled.begin(), labeled.end());
+    return labeled;
+}
+
+// --train-trigram <corpus dir> [output]: trains the byte-trigram naive-Bayes model on
+// <corpus>/<Language>/ files and writes the constexpr weight table header
+int runTrigramTraining(const vector<string>& args) {
+    if (args.size() < 2) {
+        cout << "Usage: --train-trigram <corpus dir> [trigram_model.h]\n";
+        return 1;
+    }
+    string outputPath = args.size() > 2 ? args[2] : "trigram_model.h";
+    auto labeled = collectLabeledFiles(args[1]);
+
+    vector<string> languages;
+    for (const auto& [language, path] : labeled) {
+        if (languages.empty() || languages.back() != language) languages.push_back(language);
+    }
+    if (languages.size() < 2) {
+        cout << "Need at least two language directories under " << args[1] << "\n";
+        return 1;
+    }
+
+    const int buckets = 1 << TRIGRAM_HASH_BITS;
+    vector<vector<double>> counts(languages.size(), vector<double>(buckets, 0));
+    vector<double> totals(languages.size(), 0);
+    for (const auto& [language, path] : labeled) {
+        string code;
+        if (!readSourceFile(path, code) || code.size() < 3) continue;
+        int l = find(languages.begin(), languages.end(), language) - languages.begin();
+        for (size_t i = 0; i + 2 < code.size(); i++) {
+            counts[l][trigramBucket((const unsigned char*)code.data() + i)]++;
+            totals[l]++;
+        }
+    }
+
+    // Laplace-smoothed log probabilities, centred per bucket (only differences between
+    // languages matter) and scaled to 16-bit fixed point
+    int width = (languages.size() + 3) / 4 * 4;
+    vector<vector<int>> weights(buckets, vector<int>(width, 0));
+    for (int b = 0; b < buckets; b++) {
+        vector<double> logp(languages.size());
+        double mean = 0;
+        for (size_t l = 0; l < languages.size(); l++) {
+            logp[l] = log((counts[l][b] + 1) / (totals[l] + buckets));
+            mean += logp[l] / languages.size();
+        }
+        for (size_t l = 0; l < languages.size(); l++)
+            weights[b][l] = max(-32767, min(32767, (int)lround((logp[l] - mean) * 256)));
+    }
+
+    ofstream out(outputPath);
+    if (!out.is_open()) {
+        cout << "Error opening file " << outputPath << "\n";
+        return 1;
+    }
+    out << "// Generated by `merged --train-trigram " << args[1] << "`; do not edit by hand.\n";
+    out << "// Byte-trigram naive-Bayes weights: log P(bucket | language) in 1/256 units,\n";
+    out << "// centred per bucket. Trained on " << labeled.size() << " files.\n";
+    out << "#pragma once\n#include <cstdint>\n\n";
+    out << "const int TRIGRAM_HASH_BITS = " << TRIGRAM_HASH_BITS << ";\n";
+    out << "const int TRIGRAM_LANGUAGE_COUNT = " << languages.size() << ";\n";
+    out << "const int TRIGRAM_ROW_WIDTH = " << width << ";\n";
+    out << "const char* const TRIGRAM_LANGUAGES[] = {";
+    for (size_t l = 0; l < languages.size(); l++) out << (l ? ", " : "") << "\"" << languages[l] << "\"";
+    out << "};\n\n";
+    out << "alignas(64) constexpr int16_t TRIGRAM_WEIGHTS[1 << TRIGRAM_HASH_BITS][TRIGRAM_ROW_WIDTH] = {\n";
+    for (int b = 0; b < buckets; b++) {
+        if (b % 4 == 0) out << "   ";
+        out << " {";
+        for (int l = 0; l < width; l++) out << (l ? ", " : "") << weights[b][l];
+        out << "},";
+        if (b % 4 == 3 || b + 1 == buckets) out << "\n";
+    }
+    out << "};\n";
+
+    cout << "Trained " << languages.size() << " languages on " << labeled.size()
+         << " files; wrote " << outputPath << "\n";
+    return 0;
+}
+
+// --bench-detect [dir]: accuracy and throughput of each engine on <dir>/<Language>/ files
+int runDetectionBenchmark(const vector<string>& args) {
+    string root = args.size() > 1 ? args[1] : "corpus/test";
+    vector<pair<string, string>> samples;
+    size_t totalBytes = 0;
+    for (const auto& [language, path] : collectLabeledFiles(root)) {
+        string code;
+        if (readSourceFile(path, code)) {
+            totalBytes += code.size();
+            samples.push_back({language, code});
+        }
+    }
+    if (samples.empty()) {
+        cout << "No labeled samples under " << root << "/<Language>/\n";
+        return 1;
+    }
+
+    cout << "Detection Benchmark (" << samples.size() << " samples, " << totalBytes << " bytes):\n";
+    cout << "-----------------------------------------------\n";
+    for (const char* engineName : {"trie", "trigram"}) {
+        auto engine = makeDetectionEngine(engineName);
+        int correct = 0, unknown = 0;
+        map<string, pair<int, int>> perLanguage; // Correct and total samples
+        for (const auto& [language, code] : samples) {
+            string detected = engine->detect(code);
+            correct += detected == language;
+            unknown += detected == "Unknown";
+            perLanguage[language].first += detected == language;
+            perLanguage[language].second++;
+        }
+
+        // Repeat the whole sample set until at least half a second has passed
+        size_t bytes = 0;
+        auto start = chrono::steady_clock::now();
+        double seconds = 0;
+        do {
+            for (const auto& sample : samples) {
+                engine->detect(sample.second);
+                bytes += sample.second.size();
+            }
+            seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        } while (seconds < 0.5);
+
+        cout << setw(8) << left << engineName << " accuracy " << fixed << setprecision(1)
+             << 100.0 * correct / samples.size() << "% (" << unknown << " unknown), "
+             << setprecision(3) << bytes / seconds / 1e9 << " GB/s\n";
+        cout << "        ";
+        for (const auto& [language, counts] : perLanguage)
+            cout << " " << language << " " << setprecision(1) << 100.0 * counts.first / counts.second << "%";
+        cout << "\n";
+    }
+    return 0;
+}
+
+// Token-level diff between two analysis snapshots
+// Tokens are compared as 64-bit hashes of (text, kind); the edit script comes from
+// Myers' O(ND) algorithm in its linear-space form (middle snake + divide and conquer).
+
+struct DiffHunk {
+    size_t oldStart, oldEnd; // Replaced token range [oldStart, oldEnd) of the old stream
+    size_t newStart, newEnd; // Replacement range [newStart, newEnd) of the new stream
+};
+
+vector<uint64_t> hashTokenStream(const vector<pair<string, string>>& units) {
+    vector<uint64_t> hashes;
+    hashes.reserve(units.size());
+    for (const auto& unit : units) hashes.push_back(mixHash(hashBytes(unit.first, hashBytes(unit.second))));
+    return hashes;
+}
+
+// 1-based source line of every token: NEWLINE tokens end a line, and multi-line comments
+// or strings carry their own line breaks
+vector<int> tokenLineNumbers(const vector<pair<string, string>>& units) {
+    vector<int> lines;
+    lines.reserve(units.size());
+    int line = 1;
+    for (const auto& unit : units) {
+        lines.push_back(line);
+        if (unit.first == "NEWLINE" && unit.second == "separator") line++;
+        else line += count(unit.first.begin(), unit.first.end(), '\n');
+    }
+    return lines;
+}
+
+// Edit cost after which a middle-snake search gives up on minimality
+const int64_t DIFF_COST_LIMIT = 256;
+
+class TokenDiff {
+    const uint64_t* a = nullptr;
+    const uint64_t* b = nullptr;
+    vector<int64_t> forward, backward; // Furthest x per diagonal, shared by all recursion levels
+    vector<DiffHunk> hunks;
+
+    void addHunk(size_t oldStart, size_t oldEnd, size_t newStart, size_t newEnd) {
+        if (!hunks.empty() && hunks.back().oldEnd == oldStart && hunks.back().newEnd == newStart) {
+            hunks.back().oldEnd = oldEnd;
+            hunks.back().newEnd = newEnd;
+        } else {
+            hunks.push_back({oldStart, oldEnd, newStart, newEnd});
+        }
+    }
+
+    // Finds a point on an optimal edit path through a[aLo,aHi) x b[bLo,bHi), searching
+    // from both ends until the paths overlap. Both ranges are non-empty and differ in
+    // their first and last elements.
+    pair<size_t, size_t> middleSnake(size_t aLo, size_t aHi, size_t bLo, size_t bHi) {
+        int64_t n = aHi - aLo, m = bHi - bLo;
+        int64_t delta = n - m;
+        bool odd = delta & 1;
+        int64_t maxD = (n + m + 1) / 2;
+        int64_t offset = maxD + 1;
+        forward[offset + 1] = 0;
+        backward[offset + 1] = 0;
+
+        for (int64_t d = 0; d <= maxD; d++) {
+            if (d > DIFF_COST_LIMIT) {
+                // Too expensive to find the true middle: split at the furthest-reaching
+                // forward path instead. The script stays valid but may not be minimal.
+                int64_t bestX = -1, bestY = -1;
+                for (int64_t k = -(d - 1); k <= d - 1; k += 2) {
+                    int64_t x = forward[offset + k], y = x - k;
+                    if (x <= n && y >= 0 && y <= m && x + y < n + m && x + y > bestX + bestY) bestX = x, bestY = y;
+                }
+                if (bestX >= 0) return {aLo + bestX, bLo + bestY};
+            }
+            for (int64_t k = -d; k <= d; k += 2) {
+                int64_t x = (k == -d || (k != d && forward[offset + k - 1] < forward[offset + k + 1]))
+                                ? forward[offset + k + 1] : forward[offset + k - 1] + 1;
+                int64_t y = x - k;
+                while (x < n && y < m && a[aLo + x] == b[bLo + y]) x++, y++;
+                forward[offset + k] = x;
+                int64_t reverseK = delta - k;
+                if (odd && reverseK >= -(d - 1) && reverseK <= d - 1 && x + backward[offset + reverseK] >= n)
+                    return {aLo + x, bLo + y};
+            }
+            for (int64_t k = -d; k <= d; k += 2) {
+                int64_t x = (k == -d || (k != d && backward[offset + k - 1] < backward[offset + k + 1]))
+                                ? backward[offset + k + 1] : backward[offset + k - 1] + 1;
+                int64_t y = x - k;
+                while (x < n && y < m && a[aHi - 1 - x] == b[bHi - 1 - y]) x++, y++;
+                backward[offset + k] = x;
+                int64_t forwardK = delta - k;
+                if (!odd && forwardK >= -d && forwardK <= d && forward[offset + forwardK] + x >= n)
+                    return {aLo + n - x, bLo + n - x - forwardK};
+            }
+        }
+        return {aHi, bHi}; // Unreachable: the paths always meet by maxD
+    }
+
+    void compare(size_t aLo, size_t aHi, size_t bLo, size_t bHi) {
+        while (true) {
+            while (aLo < aHi && bLo < bHi && a[aLo] == b[bLo]) aLo++, bLo++;
+            while (aLo < aHi && bLo < bHi && a[aHi - 1] == b[bHi - 1]) aHi--, bHi--;
+            if (aLo == aHi || bLo == bHi) {
+                if (aLo < aHi || bLo < bHi) addHunk(aLo, aHi, bLo, bHi);
+                return;
+            }
+            // Recurse on the first half and loop on the second, which keeps the stack
+            // shallow when the cost limit splits off one small piece at a time
+            auto [x, y] = middleSnake(aLo, aHi, bLo, bHi);
+            compare(aLo, x, bLo, y);
+            aLo = x;
+            bLo = y;
+        }
+    }
+
+    // Keeps the tokens whose hash may occur on the other side (a bitmap, so rare false
+    // positives only keep a few extra tokens). Tokens unique to one side can never be
+    // matched; dropping them stops unrelated regions from inflating the edit cost.
+    static void filterMatchable(const vector<uint64_t>& tokens, const vector<uint64_t>& other,
+                                vector<uint64_t>& kept, vector<size_t>& positions) {
+        const int bits = 23;
+        vector<uint64_t> seen(((size_t)1 << bits) / 64, 0);
+        for (uint64_t h : other) seen[(h >> (64 - bits)) / 64] |= 1ULL << ((h >> (64 - bits)) % 64);
+        kept.clear();
+        positions.clear();
+        for (size_t i = 0; i < tokens.size(); i++) {
+            uint64_t bit = tokens[i] >> (64 - bits);
+            if (seen[bit / 64] >> (bit % 64) & 1) {
+                kept.push_back(tokens[i]);
+                positions.push_back(i);
+            }
+        }
+    }
+
+public:
+    // Replaced ranges in increasing order; tokens between hunks are equal
+    vector<DiffHunk> run(const vector<uint64_t>& oldTokens, const vector<uint64_t>& newTokens) {
+        vector<uint64_t> oldKept, newKept;
+        vector<size_t> oldPositions, newPositions;
+        filterMatchable(oldTokens, newTokens, oldKept, oldPositions);
+        filterMatchable(newTokens, oldTokens, newKept, newPositions);
+
+        a = oldKept.data();
+        b = newKept.data();
+        size_t size = (oldKept.size() + newKept.size() + 1) / 2 * 2 + 4;
+        forward.assign(size, 0);
+        backward.assign(size, 0);
+        hunks.clear();
+        compare(0, oldKept.size(), 0, newKept.size());
+
+        // Map back: every gap between consecutive equal tokens is one hunk of the full streams
+        vector<DiffHunk> result;
+        size_t oldNext = 0, newNext = 0, i = 0, j = 0;
+        auto matchEqual = [&](size_t oldIndex, size_t newIndex) {
+            if (oldIndex > oldNext || newIndex > newNext) result.push_back({oldNext, oldIndex, newNext, newIndex});
+            oldNext = oldIndex + 1;
+            newNext = newIndex + 1;
+        };
+        for (const DiffHunk& hunk : hunks) {
+            while (i < hunk.oldStart) matchEqual(oldPositions[i++], newPositions[j++]);
+            i = hunk.oldEnd;
+            j = hunk.newEnd;
+        }
+        while (i < oldKept.size()) matchEqual(oldPositions[i++], newPositions[j++]);
+        if (oldNext < oldTokens.size() || newNext < newTokens.size())
+            result.push_back({oldNext, oldTokens.size(), newNext, newTokens.size()});
+        return result;
+    }
+};
+
+// An error reduced to a line-independent description, so the same error can be
+// recognised in both snapshots after lines have moved
+struct ReportedError {
+    int line; // -1 when the error has no position
+    string description;
+};
+
+vector<ReportedError> collectReportErrors(const AnalysisReport& report) {
+    vector<ReportedError> errors;
+    for (const auto& error : report.lexicalErrors)
+        errors.push_back({error.line, error.message + " '" + error.token + "'"});
+    for (const auto& error : report.quoteErrors)
+        errors.push_back({error.line, "Unclosed quote"});
+    for (const auto& error : report.bracketErrors) {
+        if (error.line == -1) errors.push_back({-1, string("Unclosed opening bracket '") + error.bracket + "'"});
+        else errors.push_back({error.line, string("Unmatched bracket '") + error.bracket + "'"});
+    }
+    for (const string& error : report.indentationErrors) {
+        // "Incorrect indentation at line 7 (...)": move the line number out of the text
+        size_t at = error.find(" at line ");
+        if (at == string::npos) {
+            errors.push_back({-1, error});
+            continue;
+        }
+        size_t digits = at + 9, end = digits;
+        while (end < error.size() && isdigit((unsigned char)error[end])) end++;
+        errors.push_back({atoi(error.c_str() + digits), error.substr(0, at) + error.substr(end)});
+    }
+    for (const auto& violation : report.ruleViolations)
+        errors.push_back({violation.line, violation.message + " (" + violation.ruleId + ")"});
+    return errors;
+}
+
+struct SnapshotDiff {
+    vector<DiffHunk> hunks;
+    vector<int> oldLines, newLines;          // Source line of every token
+    vector<ReportedError> introduced, fixed; // Errors only in the new / only in the old snapshot
+};
+
+// Diffs the token streams, then matches errors across snapshots by description and by
+// line, where old lines are carried to new lines through the unchanged tokens
+SnapshotDiff diffReports(const AnalysisReport& oldReport, const AnalysisReport& newReport) {
+    SnapshotDiff diff;
+    TokenDiff tokenDiff;
+    diff.hunks = tokenDiff.run(hashTokenStream(oldReport.lexicalUnits), hashTokenStream(newReport.lexicalUnits));
+    diff.oldLines = tokenLineNumbers(oldReport.lexicalUnits);
+    diff.newLines = tokenLineNumbers(newReport.lexicalUnits);
+
+    unordered_map<int, int> lineMap{{-1, -1}};
+    size_t i = 0, j = 0;
+    auto mapEqualRun = [&](size_t oldEnd) {
+        for (; i < oldEnd; i++, j++) lineMap.emplace(diff.oldLines[i], diff.newLines[j]);
+    };
+    for (const DiffHunk& hunk : diff.hunks) {
+        mapEqualRun(hunk.oldStart);
+        i = hunk.oldEnd;
+        j = hunk.newEnd;
+    }
+    mapEqualRun(diff.oldLines.size());
+
+    multimap<pair<string, int>, size_t> unmatchedOld;
+    vector<ReportedError> oldErrors = collectReportErrors(oldReport);
+    for (size_t e = 0; e < oldErrors.size(); e++) {
+        auto mapped = lineMap.find(oldErrors[e].line);
+        // Errors on lines that did not survive the edit cannot match anything
+        unmatchedOld.insert({{oldErrors[e].description, mapped == lineMap.end() ? -2 : mapped->second}, e});
+    }
+    for (const ReportedError& error : collectReportErrors(newReport)) {
+        auto match = unmatchedOld.find({error.description, error.line});
+        if (match != unmatchedOld.end()) unmatchedOld.erase(match);
+        else diff.introduced.push_back(error);
+    }
+    for (const auto& entry : unmatchedOld) diff.fixed.push_back(oldErrors[entry.second]);
+    auto byLine = [](const ReportedError& x, const ReportedError& y) { return x.line < y.line; };
+    stable_sort(diff.introduced.begin(), diff.introduced.end(), byLine);
+    stable_sort(diff.fixed.begin(), diff.fixed.end(), byLine);
+    return diff;
+}
+
+// Line span [first, last] covered by tokens [start, end). An empty range is an insertion
+// point: inside a line it covers that line, between lines it yields last = first - 1.
+pair<int, int> hunkLineSpan(const vector<int>& lines, size_t start, size_t end) {
+    if (start < end) return {lines[start], lines[end - 1]};
+    if (start > 0 && start < lines.size() && lines[start - 1] == lines[start]) return {lines[start], lines[start]};
+    int anchor = start < lines.size() ? lines[start] : (lines.empty() ? 1 : lines.back() + 1);
+    return {anchor, anchor - 1};
+}
+
+void printSnapshotDiff(const SnapshotDiff& diff, const string& oldCode, const string& newCode) {
+    const size_t MAX_SHOWN_LINES = 8;
+    vector<string> oldSource = splitLines(oldCode), newSource = splitLines(newCode);
+    size_t removed = 0, added = 0;
+    for (const DiffHunk& hunk : diff.hunks) {
+        removed += hunk.oldEnd - hunk.oldStart;
+        added += hunk.newEnd - hunk.newStart;
+    }
+
+    // Token hunks on the same or adjacent lines would print the same lines under several
+    // @@ headers, so hunks whose old or new line spans overlap or touch are merged first
+    vector<pair<pair<int, int>, pair<int, int>>> regions; // Old and new line spans
+    for (const DiffHunk& hunk : diff.hunks) {
+        auto oldSpan = hunkLineSpan(diff.oldLines, hunk.oldStart, hunk.oldEnd);
+        auto newSpan = hunkLineSpan(diff.newLines, hunk.newStart, hunk.newEnd);
+        if (!regions.empty() && (oldSpan.first <= regions.back().first.second + 1 ||
+                                 newSpan.first <= regions.back().second.second + 1)) {
+            auto& [lastOld, lastNew] = regions.back();
+            lastOld = {min(lastOld.first, oldSpan.first), max(lastOld.second, oldSpan.second)};
+            lastNew = {min(lastNew.first, newSpan.first), max(lastNew.second, newSpan.second)};
+            continue;
+        }
+        regions.push_back({oldSpan, newSpan});
+    }
+
+    cout << "=== TOKEN DIFF ===\n";
+    cout << "Old: " << diff.oldLines.size() << " tokens, New: " << diff.newLines.size() << " tokens\n";
+    cout << "Changed regions: " << regions.size() << " (" << removed << " tokens removed, "
+         << added << " tokens added)\n";
+
+    auto printLines = [&](const vector<string>& source, pair<int, int> span, char marker) {
+        for (int line = span.first; line <= span.second && line <= (int)source.size(); line++) {
+            if ((size_t)(line - span.first) == MAX_SHOWN_LINES) {
+                cout << marker << " ... (" << span.second - line + 1 << " more lines)\n";
+                break;
+            }
+            cout << marker << " " << source[line - 1] << "\n";
+        }
+    };
+    for (const auto& [oldSpan, newSpan] : regions) {
+        cout << "\n@@ -" << oldSpan.first << "," << oldSpan.second - oldSpan.first + 1
+             << " +" << newSpan.first << "," << newSpan.second - newSpan.first + 1 << " @@\n";
+        printLines(oldSource, oldSpan, '-');
+        printLines(newSource, newSpan, '+');
+    }
+
+    auto printErrors = [](const vector<ReportedError>& errors, const string& title, const string& lineLabel) {
+        cout << "\n" << title << " (" << errors.size() << "):\n";
+        for (const auto& error : errors) {
+            cout << "- ";
+            if (error.line != -1) cout << lineLabel << " " << error.line << ": ";
+            cout << error.description << "\n";
+        }
+    };
+    printErrors(diff.introduced, "Errors Introduced", "Line");
+    printErrors(diff.fixed, "Errors Fixed", "Old line");
+}
+
+// --diff <old file> <new file>: analyzes both snapshots and reports what the edit changed
+int runDiffMode(const vector<string>& args) {
+    if (args.size() < 3) {
+        cout << "Usage: --diff <old file> <new file> [--rules <file>]\n";
+        return 1;
+    }
+    string oldCode, newCode;
+    if (!readSourceFile(args[1], oldCode)) {
+        cout << "Error opening file " << args[1] << "\n";
+        return 1;
+    }
+    if (!readSourceFile(args[2], newCode)) {
+        cout << "Error opening file " << args[2] << "\n";
+        return 1;
+    }
+
+    RuleAutomaton ruleAutomaton(loadRulesForRun(args));
+    LexicalAnalyzer lexAnalyzer;
+    LanguageDetector langDetector;
+    AnalysisBudget budget(0);
+    AnalysisReport oldReport = runAnalysis(oldCode, lexAnalyzer, langDetector, ruleAutomaton, budget);
+    AnalysisReport newReport = runAnalysis(newCode, lexAnalyzer, langDetector, ruleAutomaton, budget);
+
+    printSnapshotDiff(diffReports(oldReport, newReport), oldCode, newCode);
+    return 0;
+}
+
+// --bench-diff [tokens]: lexes and diffs two synthetic programs of about N tokens
+// that differ by scattered line edits
+int runDiffBenchmark(const vector<string>& args) {
+    // Both programs and their tokens are held in memory, which bounds the size
+    const uint64_t maxTokens = 100000000;
+    uint64_t targetTokens = 1000000;
+    if (args.size() > 2 || (args.size() == 2 && (!parseUnsignedArg(args[1], targetTokens, maxTokens) ||
+                                                  targetTokens == 0))) {
+        cout << "Usage: --bench-diff [tokens 1.." << maxTokens << ", default 1000000]\n";
+        return 1;
+    }
+    mt19937 rng(42);
+    auto randomLine = [&]() {
+        string a = "v" + to_string(rng() % 5000), b = "v" + to_string(rng() % 5000);
+        string n = to_string(rng() % 100);
+        switch (rng() % 5) {
+            case 0: return "int " + a + " = " + b + " + " + n + ";";
+            case 1: return "if (" + a + " > " + n + ") {";
+            case 2: return a + " = compute(" + b + ", " + n + ");";
+            case 3: return string("}");
+            default: return "return " + a + ";";
+        }
+    };
+
+    vector<string> lines;
+    for (size_t tokens = 0; tokens < targetTokens; tokens += 6) lines.push_back(randomLine());
+    vector<string> edited = lines;
+    const int EDITS = 500;
+    for (int e = 0; e < EDITS; e++) {
+        size_t at = rng() % edited.size();
+        switch (rng() % 3) {
+            case 0: edited.erase(edited.begin() + at); break;
+            case 1: edited.insert(edited.begin() + at, randomLine()); break;
+            default: edited[at] = randomLine(); break;
+        }
+    }
+    auto join = [](const vector<string>& source) {
+        string code;
+        for (const string& line : source) code += line + "\n";
+        return code;
+    };
+
+    using Clock = chrono::steady_clock;
+    LexicalAnalyzer lexer;
+    auto start = Clock::now();
+    auto oldUnits = lexer.analyzeLexically(join(lines));
+    auto newUnits = lexer.analyzeLexically(join(edited));
+    double lexSeconds = chrono::duration<double>(Clock::now() - start).count();
+
+    start = Clock::now();
+    vector<uint64_t> oldHashes = hashTokenStream(oldUnits), newHashes = hashTokenStream(newUnits);
+    double hashSeconds = chrono::duration<double>(Clock::now() - start).count();
+
+    start = Clock::now();
+    TokenDiff tokenDiff;
+    vector<DiffHunk> hunks = tokenDiff.run(oldHashes, newHashes);
+    double diffSeconds = chrono::duration<double>(Clock::now() - start).count();
+
+    cout << "Diff Benchmark (" << oldUnits.size() << " vs " << newUnits.size() << " tokens, "
+         << EDITS << " line edits):\n";
+    cout << "-----------------------------------------------\n";
+    cout << fixed << setprecision(1);
+    cout << "Lexing both: " << lexSeconds * 1000 << " ms\n";
+    cout << "Hashing:     " << hashSeconds * 1000 << " ms\n";
+    cout << "Diff:        " << diffSeconds * 1000 << " ms (" << hunks.size() << " changed regions)\n";
+    return 0;
+}
+
+// Multi-file project analysis
+// Files are linked through their #include / import statements, grouped into strongly
+// connected components (include cycles) and analyzed in parallel, dependencies before
+// dependents. Results are cached in <project>/.analysis_cache under a Merkle key (the
+// file's content hash combined with the keys of everything it depends on), so after an
+// edit only the changed files and their dependents are analyzed again.
+
+const char* const PROJECT_CACHE_NAME = ".analysis_cache";
+const char* const PROJECT_CACHE_HEADER = "analysis-cache 2";
+
+struct ProjectFile {
+    string path;                   // Relative to the project root, '/'-separated
+    uint64_t contentHash = 0;
+    vector<string> imports;        // "<x>" / "\"x\"" for C++, dotted names for Java and Python
+    vector<int> dependencies;      // Resolved project files
+    int component = -1;
+    uint64_t key = 0;              // Merkle key of the result
+    bool cached = false;
+    bool dependencyErrors = false; // A file it depends on, directly or not, has errors
+    bool unreadable = false;       // Reported as an error, never cached
+    string language;
+    size_t tokenCount = 0;
+    vector<ReportedError> errors;
+};
+
+// Everything a cache entry stores; imports are reused while the content hash matches,
+// results while the Merkle key matches
+struct ProjectCacheEntry {
+    uint64_t contentHash = 0;
+    uint64_t key = 0;
+    string language;
+    size_t tokenCount = 0;
+    vector<string> imports;
+    vector<ReportedError> errors;
+};
+
+// Python import statement tokens (parentheses removed) to dotted specs; "from m import n"
+// yields "m.n", which resolves to a module n or falls back to m
+void parsePythonImport(const vector<string>& statement, vector<string>& imports) {
+    size_t i = 1;
+    string module;
+    if (statement[0] == "from") {
+        for (; i < statement.size() && statement[i] != "import"; i++) module += statement[i];
+        i++;
+    }
+    while (i < statement.size()) {
+        string name;
+        for (; i < statement.size() && statement[i] != "," && statement[i] != "as"; i++) name += statement[i];
+        while (i < statement.size() && statement[i] != ",") i++; // Skip "as alias"
+        i++;
+        if (statement[0] == "import") imports.push_back(name);
+        else if (name == "*" || name.empty()) imports.push_back(module);
+        else imports.push_back(module + (module.empty() || module.back() == '.' ? "" : ".") + name);
+    }
+}
+
+// Import specs of one file, read from its lexical units. Only statements that start a
+// line count, so commented-out imports in Python (the lexer keeps '#') are skipped.
+vector<string> extractImports(const vector<pair<string, string>>& units, const string& extension) {
+    vector<string> imports;
+    bool lineStart = true;
+    for (size_t i = 0; i < units.size(); i++) {
+        const string& text = units[i].first;
+        bool atLineStart = lineStart;
+        lineStart = text == "NEWLINE" && units[i].second == "separator";
+        if (!atLineStart) continue;
+
+        if (units[i].second == "preprocessor" && text.compare(0, 8, "#include") == 0) {
+            if (i + 1 < units.size() && units[i + 1].second == "header") {
+                imports.push_back(units[i + 1].first);
+            } else {
+                size_t open = text.find('"');
+                size_t close = open == string::npos ? open : text.find('"', open + 1);
+                if (close != string::npos) imports.push_back(text.substr(open, close - open + 1));
+            }
+        } else if (extension == ".java" && text == "import") {
+            string name;
+            size_t j = i + 1;
+            for (; j < units.size() && units[j].first != ";" && units[j].first != "NEWLINE"; j++) {
+                if (units[j].first != "static") name += units[j].first;
+            }
+            if (!name.empty()) imports.push_back(name);
+            i = j - 1;
+        } else if (extension == ".py" && (text == "import" || text == "from")) {
+            // Parenthesized name lists may continue over several lines
+            vector<string> statement;
+            int depth = 0;
+            size_t j = i;
+            for (; j < units.size() && (depth > 0 || units[j].first != "NEWLINE"); j++) {
+                if (units[j].first == "(") depth++;
+                else if (units[j].first == ")") depth--;
+                else if (units[j].first != "NEWLINE") statement.push_back(units[j].first);
+            }
+            parsePythonImport(statement, imports);
+            i = j - 1;
+        }
+    }
+    return imports;
+}
+
+string normalizeProjectPath(const string& path) {
+    string normal = filesystem::path(path).lexically_normal().generic_string();
+    return normal.compare(0, 2, "./") == 0 ? normal.substr(2) : normal;
+}
+
+string parentDirectory(const string& path) {
+    size_t slash = path.rfind('/');
+    return slash == string::npos ? "" : path.substr(0, slash);
+}
+
+// Maps import specs to project files. Non-relative specs match any file whose path ends
+// with them ("b/c.h" matches "src/b/c.h"), preferring the importer's own directory.
+class ProjectResolver {
+    const vector<ProjectFile>& files;
+    unordered_map<string, int> byPath;
+    unordered_map<string, vector<int>> bySuffix;
+    unordered_map<string, vector<int>> byDirectorySuffix; // For Java wildcard imports
+
+    static void addSuffixes(unordered_map<string, vector<int>>& index, const string& path, int id) {
+        if (path.empty()) return;
+        index[path].push_back(id);
+        for (size_t slash = path.find('/'); slash != string::npos; slash = path.find('/', slash + 1))
+            index[path.substr(slash + 1)].push_back(id);
+    }
+
+    int findExact(const string& path) const {
+        auto it = byPath.find(normalizeProjectPath(path));
+        return it == byPath.end() ? -1 : it->second;
+    }
+
+    int findSuffix(const string& suffix, const string& importerDirectory) const {
+        auto it = bySuffix.find(normalizeProjectPath(suffix));
+        if (it == bySuffix.end()) return -1;
+        for (int id : it->second) {
+            if (parentDirectory(files[id].path) == importerDirectory) return id;
+        }
+        return it->second.front();
+    }
+
+    void resolveCpp(const ProjectFile& file, const string& spec, vector<int>& out) const {
+        string name = spec.substr(1, spec.size() - 2);
+        string directory = parentDirectory(file.path);
+        int id = spec[0] == '"' ? findExact(directory.empty() ? name : directory + "/" + name) : -1;
+        if (id < 0) id = findSuffix(name, directory);
+        if (id >= 0) out.push_back(id);
+    }
+
+    void resolveJava(const ProjectFile& file, string spec, vector<int>& out) const {
+        replace(spec.begin(), spec.end(), '.', '/');
+        if (spec.size() > 2 && spec.compare(spec.size() - 2, 2, "/*") == 0) {
+            auto it = byDirectorySuffix.find(spec.substr(0, spec.size() - 2));
+            if (it != byDirectorySuffix.end()) out.insert(out.end(), it->second.begin(), it->second.end());
+            return;
+        }
+        // a.b.C, or a.b.C.member / a.b.C.Inner: drop trailing components until a file matches
+        for (string path = spec; !path.empty(); path = path.rfind('/') == string::npos ? "" : parentDirectory(path)) {
+            int id = findSuffix(path + ".java", parentDirectory(file.path));
+            if (id >= 0) {
+                out.push_back(id);
+                return;
+            }
+        }
+    }
+
+    void resolvePython(const ProjectFile& file, const string& spec, vector<int>& out) const {
+        size_t dots = 0;
+        while (dots < spec.size() && spec[dots] == '.') dots++;
+        string module = spec.substr(dots);
+        replace(module.begin(), module.end(), '.', '/');
+
+        // Relative imports start from the importer's package, one level up per extra dot
+        string base = parentDirectory(file.path);
+        for (size_t level = 1; level < dots; level++) base = parentDirectory(base);
+        auto find = [&](const string& path) {
+            if (dots == 0) return findSuffix(path, parentDirectory(file.path));
+            return findExact(base.empty() ? path : base + "/" + path);
+        };
+
+        while (true) {
+            int id = module.empty() ? find("__init__.py") : find(module + ".py");
+            if (id < 0 && !module.empty()) id = find(module + "/__init__.py");
+            if (id >= 0) {
+                out.push_back(id);
+                return;
+            }
+            if (module.empty() || (dots == 0 && module.find('/') == string::npos)) return;
+            module = parentDirectory(module);
+        }
+    }
+
+public:
+    ProjectResolver(const vector<ProjectFile>& projectFiles) : files(projectFiles) {
+        for (int id = 0; id < (int)files.size(); id++) {
+            byPath[files[id].path] = id;
+            addSuffixes(bySuffix, files[id].path, id);
+            addSuffixes(byDirectorySuffix, parentDirectory(files[id].path), id);
+        }
+    }
+
+    // Project files an import spec refers to; empty for system and third-party imports
+    vector<int> resolve(const ProjectFile& file, const string& spec) const {
+        vector<int> out;
+        string extension = filesystem::path(file.path).extension().string();
+        if (spec.size() > 2 && (spec[0] == '<' || spec[0] == '"')) resolveCpp(file, spec, out);
+        else if (extension == ".java") resolveJava(file, spec, out);
+        else if (extension == ".py") resolvePython(file, spec, out);
+        return out;
+    }
+};
+
+// Tarjan's algorithm without recursion. A component is completed only after every
+// component it depends on, so component ids come out dependencies-first.
+int findProjectComponents(vector<ProjectFile>& files) {
+    int n = files.size(), counter = 0, components = 0;
+    vector<int> index(n, -1), low(n, 0), stack;
+    vector<bool> onStack(n, false);
+    vector<pair<int, size_t>> callStack; // (file, next dependency to visit)
+
+    auto visit = [&](int v) {
+        index[v] = low[v] = counter++;
+        stack.push_back(v);
+        onStack[v] = true;
+        callStack.push_back({v, 0});
+    };
+    for (int root = 0; root < n; root++) {
+        if (index[root] != -1) continue;
+        visit(root);
+        while (!callStack.empty()) {
+            int v = callStack.back().first;
+            size_t& edge = callStack.back().second;
+            if (edge < files[v].dependencies.size()) {
+                int w = files[v].dependencies[edge++];
+                if (index[w] == -1) visit(w);
+                else if (onStack[w]) low[v] = min(low[v], index[w]);
+                continue;
+            }
+            if (low[v] == index[v]) {
+                int w;
+                do {
+                    w = stack.back();
+                    stack.pop_back();
+                    onStack[w] = false;
+                    files[w].component = components;
+                } while (w != v);
+                components++;
+            }
+            callStack.pop_back();
+            if (!callStack.empty()) low[callStack.back().first] = min(low[callStack.back().first], low[v]);
+        }
+    }
+    return components;
+}
+
+// Cache records are tab-separated lines, so backslashes, tabs and newlines in paths,
+// import specs and messages are escaped
+string escapeCacheField(const string& text) {
+    string out;
+    for (char c : text) {
+        if (c == '\\') out += "\\\\";
+        else if (c == '\t') out += "\\t";
+        else if (c == '\n') out += "\\n";
+        else out += c;
+    }
+    return out;
+}
+
+string unescapeCacheField(const string& text) {
+    string out;
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] != '\\' || i + 1 == text.size()) {
+            out += text[i];
+            continue;
+        }
+        char c = text[++i];
+        out += c == 't' ? '\t' : c == 'n' ? '\n' : c;
+    }
+    return out;
+}
+
+// Strict unsigned parse: false on an empty field, a sign or trailing garbage
+bool parseCacheNumber(const string& field, int base, uint64_t& value) {
+    if (field.empty() || !isxdigit((unsigned char)field[0])) return false;
+    char* end = nullptr;
+    errno = 0;
+    value = strtoull(field.c_str(), &end, base);
+    return errno == 0 && *end == '\0';
+}
+
+// A damaged cache is never an error: loading stops at the first record that does not
+// parse, and the files it would have covered are analyzed again
+unordered_map<string, ProjectCacheEntry> loadProjectCache(const string& path) {
+    unordered_map<string, ProjectCacheEntry> cache;
+    ifstream fin(path);
+    string line;
+    if (!getline(fin, line) || line != PROJECT_CACHE_HEADER) return cache;
+
+    while (getline(fin, line)) {
+        vector<string> fields;
+        stringstream fieldStream(line);
+        for (string field; getline(fieldStream, field, '\t');) fields.push_back(field);
+        if (fields.size() != 7) break;
+
+        ProjectCacheEntry entry;
+        uint64_t tokenCount, importCount, errorCount;
+        if (!parseCacheNumber(fields[1], 16, entry.contentHash) || !parseCacheNumber(fields[2], 16, entry.key) ||
+            !parseCacheNumber(fields[4], 10, tokenCount) || !parseCacheNumber(fields[5], 10, importCount) ||
+            !parseCacheNumber(fields[6], 10, errorCount))
+            break;
+        entry.language = fields[3];
+        entry.tokenCount = tokenCount;
+        bool complete = true;
+        for (size_t k = 0; k < importCount && (complete = (bool)getline(fin, line)); k++)
+            entry.imports.push_back(unescapeCacheField(line));
+        for (size_t k = 0; k < errorCount && complete && (complete = (bool)getline(fin, line)); k++) {
+            size_t tab = line.find('\t');
+            char* end = nullptr;
+            long errorLine = strtol(line.c_str(), &end, 10);
+            if (tab == string::npos || end != line.c_str() + tab) {
+                complete = false;
+                break;
+            }
+            entry.errors.push_back({(int)errorLine, unescapeCacheField(line.substr(tab + 1))});
+        }
+        if (!complete) break;
+        cache[unescapeCacheField(fields[0])] = entry;
+    }
+    return cache;
+}
+
+void saveProjectCache(const string& path, const vector<ProjectFile>& files) {
+    string temporary = path + ".tmp";
+    ofstream out(temporary);
+    if (!out.is_open()) return;
+    out << PROJECT_CACHE_HEADER << "\n" << hex;
+    for (const ProjectFile& file : files) {
+        if (file.unreadable) continue;
+        out << escapeCacheField(file.path) << "\t" << file.contentHash << "\t" << file.key << "\t" << file.language
+            << "\t" << dec << file.tokenCount << "\t" << file.imports.size() << "\t" << file.errors.size() << hex
+            << "\n";
+        for (const string& spec : file.imports) out << escapeCacheField(spec) << "\n";
+        for (const ReportedError& error : file.errors)
+            out << dec << error.line << hex << "\t" << escapeCacheField(error.description) << "\n";
+    }
+    out.close();
+    if (out) filesystem::rename(temporary, path);
+}
+
+uint64_t hashRules(const vector<TokenRule>& rules) {
+    uint64_t h = hashBytes(PROJECT_CACHE_HEADER);
+    for (const TokenRule& rule : rules) {
+        h = hashBytes(rule.id + "\t" + rule.language + (rule.anchored ? "^" : "") + "\t" + rule.required +
+                      "\t" + rule.terminator + "\t" + rule.message, h);
+        for (const string& token : rule.pattern) h = hashBytes(token + "\t", h);
+    }
+    return h;
+}
+
+// --project <dir> [--rules <file>]: analyze a source tree with cached, dependency-ordered
+// parallel scheduling and print a report per module (top-level directory)
+int runProjectMode(const vector<string>& args) {
+    if (args.size() < 2 || !filesystem::is_directory(args[1])) {
+        cout << "Usage: --project <directory> [--rules <file>]\n";
+        return 1;
+    }
+    using Clock = chrono::steady_clock;
+    auto start = Clock::now();
+    filesystem::path root(args[1]);
+    string cachePath = (root / PROJECT_CACHE_NAME).string();
+    unordered_map<string, ProjectCacheEntry> cache = loadProjectCache(cachePath);
+    vector<TokenRule> tokenRules = loadRulesForRun(args);
+    RuleAutomaton ruleAutomaton(tokenRules);
+    uint64_t rulesHash = hashRules(tokenRules);
+
+    vector<ProjectFile> files;
+    for (const string& path : collectSourceFiles({args[1]})) {
+        ProjectFile file;
+        file.path = normalizeProjectPath(filesystem::path(path).lexically_relative(root).generic_string());
+        files.push_back(file);
+    }
+    sort(files.begin(), files.end(), [](const ProjectFile& a, const ProjectFile& b) { return a.path < b.path; });
+    int threadCount = max(1, min<int>(defaultThreadCount(), files.size()));
+
+    // Pass 1: hash contents; files whose content changed are lexed again for their imports
+    atomic<size_t> nextFile(0);
+    auto scanWorker = [&]() {
+        LexicalAnalyzer lexer;
+        for (size_t i = nextFile++; i < files.size(); i = nextFile++) {
+            ProjectFile& file = files[i];
+            string code;
+            if (!readSourceFile((root / file.path).string(), code)) {
+                file.unreadable = true;
+                file.errors.push_back({-1, "Cannot read file"});
+                continue;
+            }
+            file.contentHash = hashBytes(code);
+            auto cached = cache.find(file.path);
+            if (cached != cache.end() && cached->second.contentHash == file.contentHash) {
+                file.imports = cached->second.imports;
+            } else {
+                file.imports = extractImports(lexer.analyzeLexically(code), filesystem::path(file.path).extension().string());
+            }
+        }
+    };
+    runWorkers(scanWorker, threadCount);
+
+    // Unreadable files are left out of the graph and the Merkle keys, so no key claims to
+    // cover an input that was never read; imports of them count as external. They rejoin
+    // the list for the report.
+    vector<ProjectFile> unreadableFiles;
+    auto firstUnreadable = stable_partition(files.begin(), files.end(),
+                                            [](const ProjectFile& file) { return !file.unreadable; });
+    move(firstUnreadable, files.end(), back_inserter(unreadableFiles));
+    files.erase(firstUnreadable, files.end());
+
+    ProjectResolver resolver(files);
+    size_t externalImports = 0;
+    for (ProjectFile& file : files) {
+        for (const string& spec : file.imports) {
+            vector<int> targets = resolver.resolve(file, spec);
+            if (targets.empty()) externalImports++;
+            file.dependencies.insert(file.dependencies.end(), targets.begin(), targets.end());
+        }
+        int self = &file - files.data();
+        sort(file.dependencies.begin(), file.dependencies.end());
+        file.dependencies.erase(unique(file.dependencies.begin(), file.dependencies.end()), file.dependencies.end());
+        file.dependencies.erase(remove(file.dependencies.begin(), file.dependencies.end(), self), file.dependencies.end());
+    }
+
+    // Condense cycles into components and compute the Merkle keys dependencies-first
+    int componentCount = findProjectComponents(files);
+    vector<vector<int>> members(componentCount), componentDependencies(componentCount), dependents(componentCount);
+    for (int id = 0; id < (int)files.size(); id++) members[files[id].component].push_back(id);
+    vector<uint64_t> componentKeys(componentCount);
+    size_t cycleFiles = 0, cycles = 0;
+    for (int c = 0; c < componentCount; c++) {
+        if (members[c].size() > 1) {
+            cycles++;
+            cycleFiles += members[c].size();
+        }
+        uint64_t key = rulesHash;
+        for (int id : members[c]) {
+            key = mixHash(key ^ files[id].contentHash);
+            for (int dependency : files[id].dependencies) {
+                int d = files[dependency].component;
+                if (d != c) componentDependencies[c].push_back(d);
+            }
+        }
+        auto& deps = componentDependencies[c];
+        sort(deps.begin(), deps.end());
+        deps.erase(unique(deps.begin(), deps.end()), deps.end());
+        for (int d : deps) {
+            key = mixHash(key ^ componentKeys[d]);
+            dependents[d].push_back(c);
+        }
+        componentKeys[c] = key;
+        for (int id : members[c]) files[id].key = mixHash(key ^ files[id].contentHash);
+    }
+
+    // Pass 2: components become ready once every component they depend on is done
+    vector<int> pendingDependencies(componentCount);
+    deque<int> ready;
+    for (int c = 0; c < componentCount; c++) {
+        pendingDependencies[c] = componentDependencies[c].size();
+        if (pendingDependencies[c] == 0) ready.push_back(c);
+    }
+    vector<char> componentHasErrors(componentCount, 0);
+    mutex schedulerMutex;
+    condition_variable readyChanged;
+    int finishedComponents = 0;
+    atomic<size_t> analyzedFiles(0);
+
+    auto analyzeWorker = [&]() {
+        LexicalAnalyzer lexAnalyzer;
+        LanguageDetector langDetector;
+        AnalysisBudget budget(0);
+        while (true) {
+            int c;
+            {
+                unique_lock<mutex> lock(schedulerMutex);
+                readyChanged.wait(lock, [&]() { return !ready.empty() || finishedComponents == componentCount; });
+                if (ready.empty()) return;
+                c = ready.front();
+                ready.pop_front();
+            }
+
+            bool hasErrors = false;
+            for (int d : componentDependencies[c]) hasErrors |= componentHasErrors[d];
+            for (int id : members[c]) {
+                ProjectFile& file = files[id];
+                auto cached = cache.find(file.path);
+                string code;
+                if (cached != cache.end() && cached->second.key == file.key) {
+                    file.cached = true;
+                    file.language = cached->second.language;
+                    file.tokenCount = cached->second.tokenCount;
+                    file.errors = cached->second.errors;
+                } else if (readSourceFile((root / file.path).string(), code)) {
+                    AnalysisReport report = runAnalysis(code, lexAnalyzer, langDetector, ruleAutomaton, budget);
+                    file.language = report.language;
+                    file.tokenCount = report.lexicalUnits.size();
+                    file.errors = collectReportErrors(report);
+                    analyzedFiles++;
+                } else {
+                    file.unreadable = true; // Removed or made unreadable since pass 1
+                    file.errors.push_back({-1, "Cannot read file"});
+                }
+            }
+            // Inside a cycle every member depends on every other member
+            bool memberErrors = false;
+            for (int id : members[c]) memberErrors |= !files[id].errors.empty();
+            for (int id : members[c]) {
+                bool otherMemberErrors = false;
+                for (int other : members[c]) otherMemberErrors |= other != id && !files[other].errors.empty();
+                files[id].dependencyErrors = hasErrors || otherMemberErrors;
+            }
+
+            lock_guard<mutex> lock(schedulerMutex);
+            componentHasErrors[c] = hasErrors || memberErrors;
+            finishedComponents++;
+            for (int d : dependents[c]) {
+                if (--pendingDependencies[d] == 0) ready.push_back(d);
+            }
+            readyChanged.notify_all();
+        }
+    };
+    runWorkers(analyzeWorker, threadCount);
+    saveProjectCache(cachePath, files);
+    double elapsedMs = chrono::duration<double, milli>(Clock::now() - start).count();
+
+    move(unreadableFiles.begin(), unreadableFiles.end(), back_inserter(files));
+    sort(files.begin(), files.end(), [](const ProjectFile& a, const ProjectFile& b) { return a.path < b.path; });
+    size_t cachedFiles = 0, unreadableCount = 0;
+    for (const ProjectFile& file : files) {
+        cachedFiles += file.cached;
+        unreadableCount += file.unreadable;
+    }
+
+    // Report per module
+    size_t edges = 0;
+    for (const ProjectFile& file : files) edges += file.dependencies.size();
+    cout << "Project Analysis: " << args[1] << "\n";
+    cout << "-----------------------------------------------\n";
+    cout << "Files: " << files.size() << " (" << analyzedFiles << " analyzed, " << cachedFiles << " cached";
+    if (unreadableCount) cout << ", " << unreadableCount << " unreadable";
+    cout << ")\n";
+    cout << "Dependencies: " << edges << " resolved, " << externalImports << " external imports\n";
+    cout << "Include cycles: " << cycles << " (" << cycleFiles << " files)\n";
+    cout << "Threads: " << threadCount << ", Time: " << fixed << setprecision(1) << elapsedMs << " ms\n";
+
+    map<string, vector<int>> modules;
+    for (int id = 0; id < (int)files.size(); id++) {
+        size_t slash = files[id].path.find('/');
+        modules[slash == string::npos ? "." : files[id].path.substr(0, slash)].push_back(id);
+    }
+    cout << "\nModules:\n";
+    for (const auto& [module, ids] : modules) {
+        size_t withErrors = 0, errors = 0, affected = 0;
+        for (int id : ids) {
+            withErrors += !files[id].errors.empty();
+            errors += files[id].errors.size();
+            affected += files[id].dependencyErrors;
+        }
+        cout << "- " << module << ": " << ids.size() << " files, " << withErrors << " with errors ("
+             << errors << " errors), " << affected << " depend on files with errors\n";
+    }
+
+    const size_t MAX_ERRORS_PER_FILE = 10;
+    bool header = false;
+    for (const ProjectFile& file : files) {
+        if (file.errors.empty()) continue;
+        if (!header) cout << "\nFiles With Errors:\n";
+        header = true;
+        cout << "- " << file.path << " (" << (file.unreadable ? "unreadable" : file.language)
+             << (file.cached ? ", cached" : "") << ")\n";
+        for (size_t k = 0; k < file.errors.size() && k < MAX_ERRORS_PER_FILE; k++) {
+            cout << "  - ";
+            if (file.errors[k].line != -1) cout << "Line " << file.errors[k].line << ": ";
+            cout << file.errors[k].description << "\n";
+        }
+        if (file.errors.size() > MAX_ERRORS_PER_FILE)
+            cout << "  - ... (" << file.errors.size() - MAX_ERRORS_PER_FILE << " more)\n";
+    }
+    return 0;
+}
+
+// Streaming analysis of compressed source archives
+// A decompressor process (gzip -dc / zstd -dc) feeds a pipe, a producer thread parses
+// the tar stream and hands source entries to analyzer threads through a queue bounded
+// in bytes. Decompression, parsing and analysis overlap and nothing touches the disk.
+
+struct ArchiveEntry {
+    size_t sequence; // Position among the analyzed entries, for ordered output
+    string path;
+    string contents;
+};
+
+// Producer/consumer queue that blocks the producer while the queued bytes exceed the cap
+class ArchiveEntryQueue {
+    deque<ArchiveEntry> entries;
+    size_t queuedBytes = 0;
+    size_t capacityBytes;
+    bool closed = false;
+    mutex queueMutex;
+    condition_variable changed;
+
+public:
+    ArchiveEntryQueue(size_t capacity) : capacityBytes(capacity) {}
+
+    void push(ArchiveEntry entry) {
+        unique_lock<mutex> lock(queueMutex);
+        // An entry larger than the cap still goes through once the queue has drained
+        changed.wait(lock, [&]() { return entries.empty() || queuedBytes + entry.contents.size() <= capacityBytes; });
+        queuedBytes += entry.contents.size();
+        entries.push_back(move(entry));
+        changed.notify_all();
+    }
+
+    // False once the queue is closed and drained
+    bool pop(ArchiveEntry& entry) {
+        unique_lock<mutex> lock(queueMutex);
+        changed.wait(lock, [&]() { return !entries.empty() || closed; });
+        if (entries.empty()) return false;
+        entry = move(entries.front());
+        entries.pop_front();
+        queuedBytes -= entry.contents.size();
+        changed.notify_all();
+        return true;
+    }
+
+    void close() {
+        lock_guard<mutex> lock(queueMutex);
+        closed = true;
+        changed.notify_all();
+    }
+};
+
+// Buffered reader over a file descriptor
+class StreamReader {
+    int fd;
+    vector<char> buffer;
+    size_t position = 0, filled = 0;
+    uint64_t consumed = 0;
+
+    bool refill() {
+        position = 0;
+        filled = 0;
+        ssize_t n;
+        do {
+            n = ::read(fd, buffer.data(), buffer.size());
+        } while (n < 0 && errno == EINTR);
+        if (n <= 0) return false;
+        filled = n;
+        return true;
+    }
+
+public:
+    StreamReader(int descriptor) : fd(descriptor), buffer(1 << 20) {}
+
+    // Appends exactly count bytes to out, or skips them when out is null
+    bool read(size_t count, string* out) {
+        while (count > 0) {
+            if (position == filled && !refill()) return false;
+            size_t chunk = min(count, filled - position);
+            if (out) out->append(buffer.data() + position, chunk);
+            position += chunk;
+            count -= chunk;
+            consumed += chunk;
+        }
+        return true;
+    }
+
+    uint64_t bytesConsumed() const {
+        return consumed;
+    }
+};
+
+// Starts "<tool> -dc" reading the archive on stdin and returns the read end of its output
+// pipe; gzip and zstd are recognised by their magic bytes, anything else is read as tar
+int openArchiveStream(const string& path, pid_t& decompressor, string& format) {
+    decompressor = -1;
+    int file = open(path.c_str(), O_RDONLY);
+    if (file < 0) return -1;
+    unsigned char magic[4] = {};
+    ssize_t n = pread(file, magic, sizeof(magic), 0);
+    const char* tool = nullptr;
+    if (n >= 2 && magic[0] == 0x1f && magic[1] == 0x8b) tool = "gzip";
+    else if (n >= 4 && magic[0] == 0x28 && magic[1] == 0xb5 && magic[2] == 0x2f && magic[3] == 0xfd) tool = "zstd";
+    format = tool ? tool : "tar";
+    if (!tool) return file;
+
+    int pipeFds[2];
+    if (pipe(pipeFds) != 0) {
+        close(file);
+        return -1;
+    }
+    decompressor = fork();
+    if (decompressor == 0) {
+        dup2(file, STDIN_FILENO);
+        dup2(pipeFds[1], STDOUT_FILENO);
+        close(file);
+        close(pipeFds[0]);
+        close(pipeFds[1]);
+        execlp(tool, tool, "-dc", (char*)nullptr);
+        _exit(127);
+    }
+    close(file);
+    close(pipeFds[1]);
+    if (decompressor < 0) {
+        close(pipeFds[0]);
+        return -1;
+    }
+    return pipeFds[0];
+}
+
+// Numeric tar header field: octal text, or base-256 when the high bit of the first byte is set
+uint64_t parseTarNumber(const char* field, size_t length) {
+    uint64_t value = 0;
+    if ((unsigned char)field[0] & 0x80) {
+        value = (unsigned char)field[0] & 0x7f;
+        for (size_t i = 1; i < length; i++) value = (value << 8) | (unsigned char)field[i];
+        return value;
+    }
+    for (size_t i = 0; i < length && field[i]; i++) {
+        if (field[i] >= '0' && field[i] <= '7') value = value * 8 + (field[i] - '0');
+    }
+    return value;
+}
+
+string tarString(const char* field, size_t length) {
+    return string(field, strnlen(field, length));
+}
+
+// Value of "path" in a pax extended header ("<length> <key>=<value>\n" records)
+string paxPath(const string& records) {
+    for (size_t at = 0; at < records.size();) {
+        size_t space = records.find(' ', at);
+        if (space == string::npos) break;
+        size_t length = strtoull(records.c_str() + at, nullptr, 10);
+        if (length == 0 || at + length > records.size()) break;
+        string record = records.substr(space + 1, at + length - space - 2);
+        if (record.compare(0, 5, "path=") == 0) return record.substr(5);
+        at += length;
+    }
+    return "";
+}
+
+struct ArchiveScan {
+    size_t entries = 0;         // Regular files in the archive
+    size_t sourceFiles = 0;     // Entries handed to the analyzers
+    size_t sourceBytes = 0;
+    size_t oversized = 0;       // Source files skipped for exceeding the entry cap
+    string error;               // Empty when the stream ended cleanly
+};
+
+// Cap on GNU long-name and pax header payloads
+const uint64_t MAX_TAR_METADATA_BYTES = 1 << 20;
+
+const string TRUNCATED_ARCHIVE = "Truncated archive";
+
+// Producer: walks the tar stream and queues source entries up to maxEntryBytes each
+ArchiveScan scanTarStream(StreamReader& reader, ArchiveEntryQueue& queue, size_t maxEntryBytes) {
+    ArchiveScan scan;
+    string header, longName;
+    while (true) {
+        header.clear();
+        if (!reader.read(512, &header)) {
+            scan.error = TRUNCATED_ARCHIVE;
+            break;
+        }
+        if (all_of(header.begin(), header.end(), [](char c) { return c == 0; })) break; // End marker
+
+        const char* block = header.data();
+        uint64_t checksum = 0;
+        for (int i = 0; i < 512; i++) checksum += (i >= 148 && i < 156) ? ' ' : (unsigned char)block[i];
+        if (checksum != parseTarNumber(block + 148, 8)) {
+            scan.error = "Corrupt tar header";
+            break;
+        }
+
+        uint64_t size = parseTarNumber(block + 124, 12);
+        uint64_t padded = (size + 511) / 512 * 512;
+        char type = block[156];
+        string name = tarString(block, 100);
+        if (memcmp(block + 257, "ustar", 5) == 0 && block[345]) name = tarString(block + 345, 155) + "/" + name;
+        if (!longName.empty()) {
+            name = longName;
+            longName.clear();
+        }
+
+        // GNU long names and pax headers describe the entry that follows
+        if (type == 'L' || type == 'x') {
+            string data;
+            if (size > MAX_TAR_METADATA_BYTES) {
+                scan.error = "Oversized tar metadata header";
+                break;
+            }
+            if (!reader.read(size, &data) || !reader.read(padded - size, nullptr)) {
+                scan.error = TRUNCATED_ARCHIVE;
+                break;
+            }
+            longName = type == 'L' ? data.substr(0, strnlen(data.c_str(), data.size())) : paxPath(data);
+            continue;
+        }
+
+        bool regular = type == '0' || type == '\0' || type == '7';
+        scan.entries += regular;
+        if (regular && isSourceFile(name) && size > maxEntryBytes) scan.oversized++;
+        if (!regular || !isSourceFile(name) || size > maxEntryBytes) {
+            if (!reader.read(padded, nullptr)) {
+                scan.error = TRUNCATED_ARCHIVE;
+                break;
+            }
+            continue;
+        }
+
+        ArchiveEntry entry{scan.sourceFiles, name, string()};
+        entry.contents.reserve(size);
+        if (!reader.read(size, &entry.contents) || !reader.read(padded - size, nullptr)) {
+            scan.error = TRUNCATED_ARCHIVE;
+            break;
+        }
+        scan.sourceFiles++;
+        scan.sourceBytes += size;
+        queue.push(move(entry));
+    }
+    queue.close();
+    return scan;
+}
+
+// A failing file kept for the listing; only the errors that get printed are stored
+struct ArchiveFileResult {
+    string path;
+    string language;
+    size_t errorCount = 0;
+    vector<ReportedError> errors;
+};
+
+const size_t MAX_LISTED_FILES = 50;
+const size_t MAX_LISTED_ERRORS = 5;
+
+// --archive <file.tar|.tar.gz|.tar.zst> [--rules <file>] [--max-entry-mb 1..1024]
+int runArchiveMode(const vector<string>& args) {
+    const char* usage = "Usage: --archive <file.tar|.tar.gz|.tar.zst> [--rules <file>] [--max-entry-mb 1..1024]\n";
+    if (args.size() < 2) {
+        cout << usage;
+        return 1;
+    }
+    // Each entry is read whole and analyzed in memory, so the cap stays well below SIZE_MAX
+    const uint64_t MAX_ENTRY_MB = 1024;
+    size_t maxEntryBytes = 16 << 20;
+    for (size_t i = 2; i < args.size(); i++) {
+        if (args[i] != "--max-entry-mb") continue;
+        uint64_t megabytes;
+        if (i + 1 == args.size() || !parseUnsignedArg(args[i + 1], megabytes, MAX_ENTRY_MB) || megabytes == 0) {
+            cout << usage;
+            return 1;
+        }
+        maxEntryBytes = (size_t)megabytes << 20;
+    }
+    const size_t QUEUE_BYTES = 64 << 20;
+
+    using Clock = chrono::steady_clock;
+    auto start = Clock::now();
+    pid_t decompressor;
+    string format;
+    int fd = openArchiveStream(args[1], decompressor, format);
+    if (fd < 0) {
+        cout << "Error opening file " << args[1] << "\n";
+        return 1;
+    }
+
+    RuleAutomaton ruleAutomaton(loadRulesForRun(args));
+    ArchiveEntryQueue queue(QUEUE_BYTES);
+    StreamReader reader(fd);
+    ArchiveScan scan;
+    thread producer([&]() { scan = scanTarStream(reader, queue, maxEntryBytes); });
+
+    // Memory stays bounded by the listing: running totals, plus the failing files with the
+    // lowest archive positions (entries finish out of order, so the highest one is evicted)
+    mutex resultsMutex;
+    map<size_t, ArchiveFileResult> listedFiles;
+    map<string, size_t> languageCounts;
+    size_t errorCount = 0, filesWithErrors = 0;
+    auto analyzeWorker = [&]() {
+        LexicalAnalyzer lexAnalyzer;
+        LanguageDetector langDetector;
+        AnalysisBudget budget(0);
+        ArchiveEntry entry;
+        while (queue.pop(entry)) {
+            AnalysisReport report = runAnalysis(entry.contents, lexAnalyzer, langDetector, ruleAutomaton, budget);
+            vector<ReportedError> errors = collectReportErrors(report);
+            lock_guard<mutex> lock(resultsMutex);
+            languageCounts[report.language]++;
+            if (errors.empty()) continue;
+            errorCount += errors.size();
+            filesWithErrors++;
+            if (listedFiles.size() == MAX_LISTED_FILES && entry.sequence > listedFiles.rbegin()->first) continue;
+            size_t total = errors.size();
+            if (errors.size() > MAX_LISTED_ERRORS) errors.resize(MAX_LISTED_ERRORS);
+            listedFiles[entry.sequence] = {entry.path, report.language, total, move(errors)};
+            if (listedFiles.size() > MAX_LISTED_FILES) listedFiles.erase(prev(listedFiles.end()));
+        }
+    };
+    // The producer and the decompressor process take their own share of the cores
+    runWorkers(analyzeWorker, max(1, defaultThreadCount() - 1));
+    producer.join();
+
+    // Stop the decompressor if parsing ended early, then collect it. A decompressor that
+    // failed also cuts the tar stream short, so its status explains a truncation; a parse
+    // error of our own closes the pipe and kills it with SIGPIPE, and is kept as reported
+    close(fd);
+    if (decompressor > 0) {
+        int status = 0;
+        waitpid(decompressor, &status, 0);
+        bool exited = WIFEXITED(status);
+        if (exited && WEXITSTATUS(status) == 127)
+            scan.error = format + " not found; it is needed to decompress " + args[1];
+        else if (!(exited && WEXITSTATUS(status) == 0) && (scan.error.empty() || scan.error == TRUNCATED_ARCHIVE))
+            scan.error = format + " failed to decompress the archive";
+    }
+    double seconds = chrono::duration<double>(Clock::now() - start).count();
+
+    cout << "Archive Analysis: " << args[1] << " (" << format << ")\n";
+    cout << "-----------------------------------------------\n";
+    if (!scan.error.empty()) cout << "Stopped early: " << scan.error << "\n";
+    cout << "Files in archive: " << scan.entries << "\n";
+    cout << "Source files analyzed: " << scan.sourceFiles << " (" << fixed << setprecision(1)
+         << scan.sourceBytes / 1048576.0 << " MB)";
+    if (scan.oversized) cout << ", " << scan.oversized << " skipped over " << (maxEntryBytes >> 20) << " MB";
+    cout << "\n";
+    cout << "Languages:";
+    for (const auto& [language, count] : languageCounts) cout << " " << language << " " << count << ";";
+    cout << "\n";
+    cout << "Errors: " << errorCount << " in " << filesWithErrors << " files\n";
+    cout << "Time: " << setprecision(2) << seconds << " s ("
+         << setprecision(1) << reader.bytesConsumed() / 1048576.0 / max(seconds, 1e-9) << " MB/s of tar data)\n";
+
+    if (!listedFiles.empty()) cout << "\nFiles With Errors:\n";
+    for (const auto& [sequence, result] : listedFiles) {
+        cout << "- " << result.path << " (" << result.language << ", " << result.errorCount << " errors)\n";
+        for (const auto& error : result.errors) {
+            cout << "  - ";
+            if (error.line != -1) cout << "Line " << error.line << ": ";
+            cout << error.description << "\n";
+        }
+        if (result.errorCount > result.errors.size())
+            cout << "  - ... (" << result.errorCount - result.errors.size() << " more)\n";
+    }
+    if (filesWithErrors > listedFiles.size())
+        cout << "- ... (" << filesWithErrors - listedFiles.size() << " more files)\n";
+    return scan.error.empty() ? 0 : 1;
+}
+
+// SIGTERM/SIGINT cancel the running analysis so partial results still get printed; so
+// does SIGXCPU, sent when an RLIMIT_CPU soft limit runs out (the hard limit follows).
+// Phases that never poll the budget (prefix detection, printing) cannot react to the
+// flag, so the first signal also restores the default action (a second signal kills the
+// process) and arms an alarm that ends the process after a grace period.
+CancellationToken analysisCancellation;
+const unsigned CANCEL_GRACE_SECONDS = 2;
+
+void handleCancelSignal(int sig) {
+    analysisCancellation.cancel();
+    signal(sig, SIG_DFL);
+    alarm(CANCEL_GRACE_SECONDS);
+}
+
+// Modify the main function to include the additional checks
+int main(int argc, char* argv[]) {
+    vector<string> args(argv + 1, argv + argc);
+    if (!args.empty() && (args[0] == "--fingerprint" || args[0] == "--match")) {
+        return runFingerprintMode(args);
+    }
+    if (!args.empty() && args[0] == "--bench-rules") {
+        return runRuleBenchmark(args);
+    }
+    if (!args.empty() && args[0] == "--stats") {
+        return runStatisticsMode(args);
+    }
+    if (!args.empty() && args[0] == "--blocks") {
+        return runBlockQueryMode(args);
+    }
+    if (!args.empty() && args[0] == "--bench-blocks") {
+        return runBlockBenchmark(args);
+    }
+    if (!args.empty() && args[0] == "--train-trigram") {
+        return runTrigramTraining(args);
+    }
+    if (!args.empty() && args[0] == "--bench-detect") {
+        return runDetectionBenchmark(args);
+    }
+    if (!args.empty() && args[0] == "--semantic-tokens") {
+        return runSemanticTokensMode(args);
+    }
+    if (!args.empty() && args[0] == "--project") {
+        return runProjectMode(args);
+    }
+    if (!args.empty() && args[0] == "--archive") {
+        return runArchiveMode(args);
+    }
+    if (!args.empty() && args[0] == "--diff") {
+        return runDiffMode(args);
+    }
+    if (!args.empty() && args[0] == "--bench-diff") {
+        return runDiffBenchmark(args);
+    }
+
+    // Initialize analyzers
+    LexicalAnalyzer lexAnalyzer;
+    LanguageDetector langDetector;
+    if (find(args.begin(), args.end(), "--ascii") != args.end()) {
+        lexAnalyzer.setUtf8Mode(false); // Legacy byte-per-character lexing
+    }
+    long long budgetMs = 0;
+    string detectorName = "trie";
+    for (size_t i = 0; i + 1 < args.size(); i++) {
+        if (args[i] == "--budget-ms") budgetMs = atoll(args[i + 1].c_str());
+        if (args[i] == "--detector") detectorName = args[i + 1];
+    }
+    // The trie scorer is runAnalysis's own detection (prefix pass, then a budgeted pass over
+    // the tokens it lexes anyway), so only other engines are handed in
+    unique_ptr<DetectionEngine> engine;
+    if (detectorName != "trie") {
+        engine = makeDetectionEngine(detectorName);
+        if (!engine) {
+            cout << "Unknown detector '" << detectorName << "' (expected trie or trigram)\n";
+            return 1;
+        }
+    }
+    
+    // Read input file
+    ifstream fin("lexicalinput.txt");
+    if (!fin.is_open()) {
+        cout << "Error opening file\n";
+        return 1;
+    }
+    
+    stringstream buffer;
+    buffer << fin.rdbuf();
+    string code = buffer.str();
+    fin.close();
+
+    signal(SIGTERM, handleCancelSignal);
+    signal(SIGINT, handleCancelSignal);
+    signal(SIGXCPU, handleCancelSignal);
+    AnalysisBudget budget(budgetMs, &analysisCancellation);
+    RuleAutomaton ruleAutomaton(loadRulesForRun(args));
+
+    AnalysisReport report = runAnalysis(code, lexAnalyzer, langDetector, ruleAutomaton, budget, engine.get());
+    printAnalysisReport(report, code);
 
     return 0;
 }
@@ -0,0 +1,20 @@
+#!/bin/sh
+# Runs the analyzer on every regression input and compares with the recorded output.
+# Usage: regression/run.sh <path to compiled merged binary>
+binary=$(realpath "$1")
+cd "$(dirname "$0")" || exit 1
+status=0
+for input in *.txt; do
+    work=$(mktemp -d)
+    cp "$input" "$work/lexicalinput.txt"
+    cp ../rules.txt "$work/"
+    (cd "$work" && timeout 10 "$binary") > "$work/actual" 2>&1
+    if ! cmp -s "$work/actual" "${input%.txt}.expected"; then
+        echo "FAIL: $input"
+        diff "${input%.txt}.expected" "$work/actual" | head -20
+        status=1
+    fi
+    rm -rf "$work"
+done
+[ $status -eq 0 ] && echo "All regression inputs passed"
+exit $status
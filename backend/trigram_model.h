@@ -0,0 +1,1037 @@
+// Generated by `merged --train-trigram corpus/train`; do not edit by hand.
+// Byte-trigram naive-Bayes weights: log P(bucket | language) in 1/256 units,
+// centred per bucket. Trained on 27 files.
+#pragma once
+#include <cstdint>
+
+const int TRIGRAM_HASH_BITS = 12;
+const int TRIGRAM_LANGUAGE_COUNT = 3;
+const int TRIGRAM_ROW_WIDTH = 4;
+const char* const TRIGRAM_LANGUAGES[] = {"C++", "Java", "Python"};
+
+alignas(64) constexpr int16_t TRIGRAM_WEIGHTS[1 << TRIGRAM_HASH_BITS][TRIGRAM_ROW_WIDTH] = {
+    {-5, -10, 15, 0}, {113, -69, -44, 0}, {176, -241, 65, 0}, {-202, 9, 193, 0},
+    {-45, 70, -25, 0}, {30, -79, 50, 0}, {39, -121, 82, 0}, {162, -94, -69, 0},
+    {-99, 177, -79, 0}, {21, -127, 106, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-1, -6, 7, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0},
+    {-30, 143, -113, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-24, 206, -181, 0},
+    {-279, 144, 135, 0}, {-5, -10, 15, 0}, {-12, 37, -24, 0}, {45, -241, 196, 0},
+    {-158, 15, 143, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {131, 39, -170, 0},
+    {-123, -128, 252, 0}, {232, -128, -103, 0}, {182, -104, -79, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {20, 118, -138, 0}, {182, -104, -79, 0}, {146, -271, 125, 0},
+    {113, -69, -44, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {270, -147, -122, 0}, {-64, 108, -44, 0}, {35, 87, -122, 0}, {-5, -10, 15, 0},
+    {-77, 135, -57, 0}, {113, -69, -44, 0}, {217, -350, 133, 0}, {150, 179, -328, 0},
+    {-5, -10, 15, 0}, {-99, -104, 203, 0}, {-64, 108, -44, 0}, {256, 0, -256, 0},
+    {-132, 114, 19, 0}, {-64, -69, 133, 0}, {162, 188, -350, 0}, {172, -10, -162, 0},
+    {-5, -10, 15, 0}, {-182, -187, 370, 0}, {-26, 387, -361, 0}, {-5, -10, 15, 0},
+    {113, -69, -44, 0}, {-64, -69, 133, 0}, {-123, -128, 252, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {25, 181, -206, 0}, {202, -25, -177, 0}, {-158, 296, -138, 0},
+    {-5, -10, 15, 0}, {2, -67, 65, 0}, {113, -69, -44, 0}, {-64, 108, -44, 0},
+    {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-252, -79, 331, 0}, {45, -7, -39, 0}, {44, -35, -10, 0}, {-59, -7, 65, 0},
+    {-64, 108, -44, 0}, {232, -128, -103, 0}, {-5, -10, 15, 0}, {211, -207, -4, 0},
+    {-14, 112, -98, 0}, {-5, -10, 15, 0}, {329, -266, -63, 0}, {-5, -10, 15, 0},
+    {122, -48, -74, 0}, {89, -20, -69, 0}, {232, -128, -103, 0}, {-236, 40, 196, 0},
+    {-123, 49, 74, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0}, {182, 74, -256, 0},
+    {-158, 118, 40, 0}, {30, 202, -232, 0}, {-136, 36, 100, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-219, 97, 122, 0}, {-15, 66, -52, 0}, {-5, -10, 15, 0},
+    {-330, 77, 253, 0}, {-99, -104, 203, 0}, {16, -270, 253, 0}, {-40, 59, -20, 0},
+    {-54, 192, -138, 0}, {-64, -69, 133, 0}, {172, -187, 15, 0}, {-64, 108, -44, 0},
+    {232, -128, -103, 0}, {-5, -187, 192, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {232, -128, -103, 0}, {-335, 15, 321, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {232, -128, -103, 0}, {-5, -10, 15, 0}, {-123, -55, 178, 0}, {-5, -10, 15, 0},
+    {-64, -69, 133, 0}, {182, -104, -79, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {232, -128, -103, 0}, {232, -128, -103, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-276, 355, -79, 0}, {123, 15, -138, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0},
+    {113, -69, -44, 0}, {195, -332, 137, 0}, {-192, 84, 109, 0}, {-5, -10, 15, 0},
+    {-123, -128, 252, 0}, {-5, -10, 15, 0}, {-123, -128, 252, 0}, {-99, -104, 203, 0},
+    {172, -187, 15, 0}, {-171, 322, -151, 0}, {-64, -69, 133, 0}, {301, -163, -138, 0},
+    {-201, 383, -181, 0}, {-99, 177, -79, 0}, {89, -198, 109, 0}, {182, -104, -79, 0},
+    {-5, -10, 15, 0}, {41, -141, 100, 0}, {158, -55, -103, 0}, {-5, -10, 15, 0},
+    {123, 15, -138, 0}, {31, -117, 86, 0}, {-64, -69, 133, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {276, -187, -89, 0}, {-5, -10, 15, 0}, {44, -35, -10, 0},
+    {-64, -69, 133, 0}, {-40, 59, -20, 0}, {-64, 108, -44, 0}, {177, -485, 307, 0},
+    {-192, 84, 109, 0}, {-5, -10, 15, 0}, {117, -19, -98, 0}, {138, 59, -197, 0},
+    {89, 84, -172, 0}, {-252, 202, 50, 0}, {270, -147, -122, 0}, {-64, -69, 133, 0},
+    {-171, -176, 347, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-40, -45, 84, 0},
+    {-22, 24, -2, 0}, {-182, -10, 192, 0}, {117, -19, -98, 0}, {495, -401, -95, 0},
+    {79, -104, 25, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {20, -163, 143, 0},
+    {-5, -10, 15, 0}, {-242, -247, 488, 0}, {-64, 108, -44, 0}, {370, -198, -172, 0},
+    {-53, -58, 111, 0}, {-5, -10, 15, 0}, {123, -163, 40, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {30, -257, 227, 0}, {-5, -10, 15, 0}, {-24, 206, -181, 0},
+    {-182, 167, 15, 0}, {74, -138, 64, 0}, {173, -171, -2, 0}, {551, -288, -263, 0},
+    {-158, 118, 40, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {89, 84, -172, 0},
+    {-64, 108, -44, 0}, {117, 158, -275, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-36, 109, -73, 0}, {69, 64, -133, 0}, {1, -78, 78, 0}, {113, -69, -44, 0},
+    {-182, 345, -162, 0}, {54, -128, 74, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-99, 177, -79, 0}, {54, -128, 74, 0}, {46, -176, 130, 0}, {-142, 87, 55, 0},
+    {-99, 177, -79, 0}, {-64, -173, 237, 0}, {-83, -88, 171, 0}, {-24, -29, 53, 0},
+    {113, -69, -44, 0}, {-139, 258, -119, 0}, {-5, -10, 15, 0}, {20, -163, 143, 0},
+    {-5, -10, 15, 0}, {-5, 167, -162, 0}, {45, -241, 196, 0}, {-5, -10, 15, 0},
+    {14, 9, -23, 0}, {-30, 39, -10, 0}, {-123, -128, 252, 0}, {404, -215, -190, 0},
+    {2, -220, 217, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {92, -147, 55, 0},
+    {-158, 118, 40, 0}, {-74, 128, -54, 0}, {-230, 440, -210, 0}, {-5, -10, 15, 0},
+    {-123, 49, 74, 0}, {523, -274, -249, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {182, -104, -79, 0}, {-261, 146, 114, 0}, {-64, -69, 133, 0},
+    {123, -163, 40, 0}, {-64, -69, 133, 0}, {182, -281, 99, 0}, {-49, -54, 102, 0},
+    {113, -69, -44, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-99, -104, 203, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-99, -104, 203, 0}, {58, -182, 124, 0},
+    {182, -104, -79, 0}, {-96, 275, -179, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {80, 102, -181, 0}, {-86, 70, 16, 0}, {-182, -187, 370, 0}, {16, 68, -84, 0},
+    {113, -69, -44, 0}, {-182, 167, 15, 0}, {-261, 146, 114, 0}, {123, -163, 40, 0},
+    {182, -104, -79, 0}, {113, -69, -44, 0}, {-123, 49, 74, 0}, {-158, 15, 143, 0},
+    {-158, 15, 143, 0}, {104, 185, -288, 0}, {174, -329, 155, 0}, {94, -31, -63, 0},
+    {-64, -69, 133, 0}, {123, 15, -138, 0}, {113, -69, -44, 0}, {118, 223, -341, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-64, -69, 133, 0},
+    {-64, -69, 133, 0}, {-64, 108, -44, 0}, {-64, 108, -44, 0}, {33, -29, -4, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-30, 143, -113, 0}, {-123, 49, 74, 0},
+    {-5, -10, 15, 0}, {-54, 192, -138, 0}, {-5, -10, 15, 0}, {135, 169, -304, 0},
+    {-158, -163, 321, 0}, {-5, -10, 15, 0}, {64, -222, 158, 0}, {-5, -94, 99, 0},
+    {123, -163, 40, 0}, {-142, -147, 290, 0}, {-74, 25, 50, 0}, {123, -163, 40, 0},
+    {-64, 108, -44, 0}, {-99, -104, 203, 0}, {-158, 15, 143, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {242, -222, -20, 0},
+    {148, -138, -10, 0}, {-57, -62, 118, 0}, {454, -187, -266, 0}, {-64, -69, 133, 0},
+    {66, -294, 229, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {44, -35, -10, 0},
+    {-64, -69, 133, 0}, {-10, 280, -271, 0}, {58, -5, -53, 0}, {-40, -222, 262, 0},
+    {-5, -10, 15, 0}, {123, -163, 40, 0}, {-252, 25, 227, 0}, {-217, 59, 158, 0},
+    {54, -128, 74, 0}, {-64, 108, -44, 0}, {89, -198, 109, 0}, {232, -128, -103, 0},
+    {123, 15, -138, 0}, {-5, -10, 15, 0}, {198, -266, 68, 0}, {172, -10, -162, 0},
+    {-99, -104, 203, 0}, {-229, 1, 228, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0},
+    {-54, 15, 40, 0}, {203, -83, -120, 0}, {113, -69, -44, 0}, {-64, -69, 133, 0},
+    {232, -128, -103, 0}, {-5, -10, 15, 0}, {-99, 177, -79, 0}, {-64, 108, -44, 0},
+    {-99, -104, 203, 0}, {-123, 49, 74, 0}, {-61, 336, -275, 0}, {-5, -187, 192, 0},
+    {138, -45, -93, 0}, {-99, -104, 203, 0}, {-64, 108, -44, 0}, {363, -54, -310, 0},
+    {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {45, -241, 196, 0}, {-5, -10, 15, 0}, {182, -104, -79, 0}, {-158, -163, 321, 0},
+    {-5, 167, -162, 0}, {-10, -96, 106, 0}, {54, -128, 74, 0}, {-40, -45, 84, 0},
+    {-5, -10, 15, 0}, {-53, -235, 288, 0}, {54, -128, 74, 0}, {-5, -10, 15, 0},
+    {-230, 440, -210, 0}, {-5, -10, 15, 0}, {192, -5, -187, 0}, {-5, -10, 15, 0},
+    {137, 96, -233, 0}, {-5, -10, 15, 0}, {-201, -207, 408, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {124, 132, -255, 0}, {-158, -163, 321, 0}, {10, 15, -25, 0},
+    {20, 118, -138, 0}, {-64, 108, -44, 0}, {-99, 0, 99, 0}, {-306, 414, -108, 0},
+    {-99, -104, 203, 0}, {172, -10, -162, 0}, {-308, 185, 124, 0}, {-142, 265, -122, 0},
+    {54, -128, 74, 0}, {113, -69, -44, 0}, {-244, 365, -120, 0}, {-217, 59, 158, 0},
+    {182, -104, -79, 0}, {-383, -211, 594, 0}, {-5, -10, 15, 0}, {-30, -35, 64, 0},
+    {20, -163, 143, 0}, {54, 49, -103, 0}, {-123, -128, 252, 0}, {-64, 108, -44, 0},
+    {-40, 237, -197, 0}, {-5, -10, 15, 0}, {-99, 177, -79, 0}, {-54, -163, 217, 0},
+    {232, -128, -103, 0}, {148, -35, -113, 0}, {-25, -43, 68, 0}, {-261, -88, 349, 0},
+    {30, -79, 50, 0}, {359, -140, -219, 0}, {21, 81, -102, 0}, {89, 84, -172, 0},
+    {113, -69, -44, 0}, {-26, 89, -63, 0}, {113, -69, -44, 0}, {-192, 365, -172, 0},
+    {-2, -64, 65, 0}, {-64, -69, 133, 0}, {54, 49, -103, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-77, 135, -57, 0},
+    {30, 25, -54, 0}, {-49, -157, 206, 0}, {208, -277, 69, 0}, {163, -300, 137, 0},
+    {113, -69, -44, 0}, {-5, -10, 15, 0}, {-295, 158, 137, 0}, {-64, 108, -44, 0},
+    {113, -69, -44, 0}, {-123, 49, 74, 0}, {123, -163, 40, 0}, {187, 35, -222, 0},
+    {-121, 91, 30, 0}, {-182, -187, 370, 0}, {30, 25, -54, 0}, {-14, -123, 137, 0},
+    {12, 276, -288, 0}, {-17, 14, 3, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0},
+    {-64, 108, -44, 0}, {-210, -215, 424, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-7, 98, -91, 0}, {-5, -10, 15, 0}, {-73, 53, 21, 0}, {-64, 108, -44, 0},
+    {-150, -155, 306, 0}, {113, -69, -44, 0}, {-77, -82, 160, 0}, {64, -45, -20, 0},
+    {-64, -69, 133, 0}, {-142, 265, -122, 0}, {120, -1, -119, 0}, {-64, 108, -44, 0},
+    {-5, -10, 15, 0}, {-123, -128, 252, 0}, {54, -128, 74, 0}, {-5, 167, -162, 0},
+    {131, 39, -170, 0}, {209, -117, -92, 0}, {113, -350, 237, 0}, {-158, 118, 40, 0},
+    {113, -69, -44, 0}, {-5, -10, 15, 0}, {-158, 118, 40, 0}, {-182, -10, 192, 0},
+    {-92, 34, 59, 0}, {-158, 118, 40, 0}, {-64, -69, 133, 0}, {-2, -64, 65, 0},
+    {370, -198, -172, 0}, {-142, 265, -122, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0},
+    {-64, -69, 133, 0}, {44, -35, -10, 0}, {581, -303, -278, 0}, {-64, -69, 133, 0},
+    {45, -7, -39, 0}, {-217, 414, -197, 0}, {-64, -69, 133, 0}, {113, -69, -44, 0},
+    {82, -157, 75, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {398, -300, -98, 0},
+    {182, -104, -79, 0}, {-5, -10, 15, 0}, {54, 49, -103, 0}, {113, -69, -44, 0},
+    {174, -48, -126, 0}, {-123, 49, 74, 0}, {-123, 49, 74, 0}, {89, -198, 109, 0},
+    {89, -198, 109, 0}, {54, 49, -103, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-123, 49, 74, 0}, {-5, -10, 15, 0}, {54, 49, -103, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {232, -128, -103, 0}, {-212, 18, 194, 0}, {-5, -10, 15, 0},
+    {-99, -104, 203, 0}, {67, -73, 6, 0}, {-99, -104, 203, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {264, 458, -722, 0}, {-5, -10, 15, 0}, {-49, 77, -29, 0},
+    {-13, 120, -106, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0}, {-280, -285, 564, 0},
+    {113, -69, -44, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {113, -69, -44, 0},
+    {54, 49, -103, 0}, {-158, 15, 143, 0}, {-383, 287, 96, 0}, {-19, -144, 162, 0},
+    {352, -329, -23, 0}, {113, -69, -44, 0}, {-63, -129, 192, 0}, {96, -126, 30, 0},
+    {-5, -10, 15, 0}, {-73, 53, 21, 0}, {-190, 126, 65, 0}, {-5, -10, 15, 0},
+    {-65, -13, 79, 0}, {20, -340, 321, 0}, {-64, 108, -44, 0}, {-26, -88, 114, 0},
+    {233, -270, 36, 0}, {172, -187, 15, 0}, {-123, 49, 74, 0}, {-64, 108, -44, 0},
+    {-64, -69, 133, 0}, {-276, 0, 276, 0}, {-5, -10, 15, 0}, {-33, 24, 9, 0},
+    {89, -198, 109, 0}, {-5, -10, 15, 0}, {270, -147, -122, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-74, 185, -111, 0}, {182, -104, -79, 0},
+    {80, 36, -116, 0}, {113, -69, -44, 0}, {-171, -176, 347, 0}, {-5, -10, 15, 0},
+    {-64, -69, 133, 0}, {235, -78, -157, 0}, {479, -252, -227, 0}, {270, -147, -122, 0},
+    {-5, -10, 15, 0}, {419, -222, -197, 0}, {-5, -10, 15, 0}, {-49, 32, 17, 0},
+    {-123, 49, 74, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-171, -176, 347, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-40, 237, -197, 0}, {-8, -248, 256, 0},
+    {54, -128, 74, 0}, {-61, 55, 6, 0}, {-5, -10, 15, 0}, {148, -316, 168, 0},
+    {-5, -10, 15, 0}, {280, -204, -76, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-88, 109, -21, 0}, {-73, 53, 21, 0}, {-242, -247, 488, 0}, {426, -432, 5, 0},
+    {-236, 171, 65, 0}, {45, -64, 19, 0}, {232, -128, -103, 0}, {-5, -10, 15, 0},
+    {-99, 177, -79, 0}, {-5, -10, 15, 0}, {162, -94, -69, 0}, {182, -104, -79, 0},
+    {-38, 2, 37, 0}, {-72, 125, -52, 0}, {270, -147, -122, 0}, {242, -222, -20, 0},
+    {-64, 108, -44, 0}, {154, -250, 96, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0},
+    {29, 68, -98, 0}, {-5, -10, 15, 0}, {174, 130, -304, 0}, {-64, 108, -44, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0}, {-57, 2, 54, 0},
+    {-123, 49, 74, 0}, {233, -270, 36, 0}, {-182, 167, 15, 0}, {89, 84, -172, 0},
+    {270, -147, -122, 0}, {92, -147, 55, 0}, {-99, 0, 99, 0}, {-102, -50, 152, 0},
+    {-123, -128, 252, 0}, {79, -104, 25, 0}, {64, -45, -20, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-115, 335, -220, 0}, {182, -104, -79, 0},
+    {-99, 177, -79, 0}, {-80, 93, -13, 0}, {-142, -147, 290, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-182, -187, 370, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0},
+    {-230, 263, -33, 0}, {-99, -104, 203, 0}, {-5, -10, 15, 0}, {-289, 61, 229, 0},
+    {-5, -10, 15, 0}, {-422, 209, 212, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-123, 49, 74, 0}, {-5, -10, 15, 0}, {-298, 576, -278, 0}, {16, 228, -245, 0},
+    {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-123, -128, 252, 0}, {5, 74, -79, 0},
+    {-5, -10, 15, 0}, {11, -41, 31, 0}, {-158, 118, 40, 0}, {-5, -10, 15, 0},
+    {30, 379, -409, 0}, {-158, 118, 40, 0}, {-142, -147, 290, 0}, {-210, -215, 424, 0},
+    {64, 133, -197, 0}, {155, -244, 89, 0}, {55, -152, 97, 0}, {182, -104, -79, 0},
+    {80, -207, 127, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-182, 345, -162, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {54, -128, 74, 0},
+    {11, 159, -171, 0}, {-40, -222, 262, 0}, {-201, -29, 231, 0}, {-118, 393, -275, 0},
+    {-5, -10, 15, 0}, {-104, 188, -84, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-10, -158, 168, 0}, {-64, -69, 133, 0}, {-142, 265, -122, 0}, {-64, -69, 133, 0},
+    {-99, -104, 203, 0}, {-5, -10, 15, 0}, {79, 0, -79, 0}, {123, 192, -315, 0},
+    {20, -163, 143, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {168, 266, -434, 0}, {-5, -10, 15, 0}, {65, -73, 8, 0}, {-158, 15, 143, 0},
+    {-74, 25, 50, 0}, {35, -90, 55, 0}, {-5, -10, 15, 0}, {-90, -507, 598, 0},
+    {-5, -187, 192, 0}, {54, -128, 74, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {232, -128, -103, 0}, {-99, -104, 203, 0}, {-123, -128, 252, 0}, {479, -252, -227, 0},
+    {-64, -173, 237, 0}, {-182, 167, 15, 0}, {270, -147, -122, 0}, {-201, 206, -4, 0},
+    {-40, -45, 84, 0}, {-64, 286, -222, 0}, {-5, -10, 15, 0}, {54, -128, 74, 0},
+    {113, -69, -44, 0}, {301, -163, -138, 0}, {113, -69, -44, 0}, {-54, 192, -138, 0},
+    {-276, 177, 99, 0}, {-64, 108, -44, 0}, {-99, 177, -79, 0}, {-5, -10, 15, 0},
+    {-123, 49, 74, 0}, {-5, -10, 15, 0}, {-99, -104, 203, 0}, {174, -225, 51, 0},
+    {-269, 518, -249, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {115, 71, -186, 0},
+    {232, -128, -103, 0}, {357, 417, -775, 0}, {-64, 108, -44, 0}, {20, 118, -138, 0},
+    {-74, 25, 50, 0}, {-40, -45, 84, 0}, {-5, -10, 15, 0}, {-99, -104, 203, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0},
+    {54, -128, 74, 0}, {123, -163, 40, 0}, {-5, -10, 15, 0}, {291, -247, -44, 0},
+    {54, -128, 74, 0}, {251, 68, -319, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-131, -79, 210, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-64, -69, 133, 0}, {-123, 49, 74, 0}, {209, -294, 86, 0}, {-40, 237, -197, 0},
+    {20, -163, 143, 0}, {-72, -77, 150, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-123, 49, 74, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {20, 118, -138, 0}, {-5, -10, 15, 0}, {20, -163, 143, 0}, {-5, -10, 15, 0},
+    {-30, -35, 64, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-142, -147, 290, 0},
+    {-5, -10, 15, 0}, {-123, 49, 74, 0}, {-158, 15, 143, 0}, {-36, -157, 194, 0},
+    {-5, -10, 15, 0}, {-311, 39, 272, 0}, {-40, -222, 262, 0}, {-5, -10, 15, 0},
+    {54, 49, -103, 0}, {-5, -10, 15, 0}, {103, -80, -23, 0}, {-64, 108, -44, 0},
+    {-201, -207, 408, 0}, {-64, -69, 133, 0}, {-99, -104, 203, 0}, {-265, 228, 36, 0},
+    {-99, -104, 203, 0}, {89, 84, -172, 0}, {132, 127, -260, 0}, {-5, -10, 15, 0},
+    {123, 192, -315, 0}, {-99, 177, -79, 0}, {-64, -69, 133, 0}, {-64, -69, 133, 0},
+    {-64, -69, 133, 0}, {-9, -105, 115, 0}, {-142, 30, 112, 0}, {5, -104, 99, 0},
+    {-64, 108, -44, 0}, {-64, 108, -44, 0}, {27, 0, -27, 0}, {-64, -69, 133, 0},
+    {-64, -69, 133, 0}, {117, -300, 183, 0}, {182, -104, -79, 0}, {232, -128, -103, 0},
+    {-158, 15, 143, 0}, {242, 250, -492, 0}, {-99, 177, -79, 0}, {-5, -10, 15, 0},
+    {92, -147, 55, 0}, {79, -104, 25, 0}, {565, -207, -359, 0}, {-50, 12, 37, 0},
+    {-5, 167, -162, 0}, {-5, -10, 15, 0}, {-108, 18, 90, 0}, {-158, 296, -138, 0},
+    {-15, -33, 48, 0}, {-36, -98, 134, 0}, {-99, -104, 203, 0}, {-210, -215, 424, 0},
+    {-64, 108, -44, 0}, {17, -85, 69, 0}, {115, 71, -186, 0}, {-64, 108, -44, 0},
+    {-99, -104, 203, 0}, {-276, -104, 380, 0}, {-182, 345, -162, 0}, {291, -247, -44, 0},
+    {-165, 132, 33, 0}, {-5, -291, 296, 0}, {-5, -10, 15, 0}, {-99, -104, 203, 0},
+    {-21, 21, -1, 0}, {45, 171, -216, 0}, {-230, 263, -33, 0}, {360, 184, -544, 0},
+    {-230, 440, -210, 0}, {-192, -198, 390, 0}, {-15, -198, 213, 0}, {-54, 15, 40, 0},
+    {-142, -147, 290, 0}, {-265, 228, 36, 0}, {-158, 118, 40, 0}, {-99, -104, 203, 0},
+    {-192, -198, 390, 0}, {242, -45, -197, 0}, {20, 118, -138, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0},
+    {-236, 40, 196, 0}, {-64, -69, 133, 0}, {-64, 108, -44, 0}, {30, 25, -54, 0},
+    {182, -281, 99, 0}, {-99, -104, 203, 0}, {-49, 77, -29, 0}, {-142, -147, 290, 0},
+    {5, 74, -79, 0}, {23, -94, 71, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-142, -147, 290, 0}, {-5, -10, 15, 0}, {92, 208, -300, 0},
+    {-5, -10, 15, 0}, {54, -128, 74, 0}, {-14, 289, -275, 0}, {113, -69, -44, 0},
+    {-5, -10, 15, 0}, {54, 49, -103, 0}, {-5, -10, 15, 0}, {-217, 237, -20, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-210, 399, -190, 0}, {-123, 49, 74, 0},
+    {-74, 25, 50, 0}, {253, -388, 135, 0}, {327, -176, -151, 0}, {-24, -207, 231, 0},
+    {-5, -10, 15, 0}, {-99, -104, 203, 0}, {-24, 206, -181, 0}, {13, -649, 636, 0},
+    {293, -33, -259, 0}, {-64, -69, 133, 0}, {-49, 77, -29, 0}, {-2, -64, 65, 0},
+    {-64, 108, -44, 0}, {113, -69, -44, 0}, {-20, 111, -91, 0}, {-93, 109, -16, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-142, 265, -122, 0}, {5, 74, -79, 0}, {276, -291, 15, 0}, {113, -69, -44, 0},
+    {388, -207, -181, 0}, {182, -104, -79, 0}, {-5, -10, 15, 0}, {-158, 296, -138, 0},
+    {54, -128, 74, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-5, -10, 15, 0}, {174, 56, -230, 0}, {176, -241, 65, 0}, {-64, -69, 133, 0},
+    {-151, -26, 177, 0}, {-182, 345, -162, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-242, 108, 133, 0}, {113, -69, -44, 0}, {-74, 25, 50, 0},
+    {113, -69, -44, 0}, {182, -104, -79, 0}, {-64, 108, -44, 0}, {-123, 49, 74, 0},
+    {-64, -69, 133, 0}, {-64, -69, 133, 0}, {-8, 64, -57, 0}, {148, -158, 10, 0},
+    {-99, -104, 203, 0}, {-99, -104, 203, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0},
+    {-335, 15, 321, 0}, {7, -2, -5, 0}, {176, -241, 65, 0}, {-5, -10, 15, 0},
+    {-123, -128, 252, 0}, {-24, -207, 231, 0}, {-36, -323, 359, 0}, {-64, -9, 73, 0},
+    {-201, -29, 231, 0}, {233, 77, -310, 0}, {176, -241, 65, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {182, -104, -79, 0}, {114, -98, -16, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {11, -18, 7, 0}, {-38, 120, -82, 0}, {-64, 108, -44, 0},
+    {219, -211, -8, 0}, {-99, 177, -79, 0}, {47, 271, -318, 0}, {20, -59, 40, 0},
+    {-99, -104, 203, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {-5, -10, 15, 0}, {89, -198, 109, 0}, {-44, 224, -180, 0},
+    {54, -128, 74, 0}, {174, -394, 221, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-123, -128, 252, 0}, {-99, 177, -79, 0}, {-5, -10, 15, 0}, {-99, 177, -79, 0},
+    {89, -464, 375, 0}, {151, -266, 114, 0}, {-3, 32, -29, 0}, {182, -104, -79, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0}, {163, 112, -275, 0},
+    {-64, 108, -44, 0}, {-74, -257, 331, 0}, {370, -198, -172, 0}, {-99, 177, -79, 0},
+    {-5, -10, 15, 0}, {280, -382, 102, 0}, {54, -128, 74, 0}, {113, -69, -44, 0},
+    {-158, 296, -138, 0}, {-54, 15, 40, 0}, {-83, 146, -63, 0}, {-5, -10, 15, 0},
+    {233, 77, -310, 0}, {173, -446, 273, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0},
+    {291, -69, -222, 0}, {-15, -198, 213, 0}, {-177, 99, 78, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {-123, 49, 74, 0}, {182, -104, -79, 0}, {-64, -69, 133, 0},
+    {41, -141, 100, 0}, {208, 178, -386, 0}, {-24, -207, 231, 0}, {-5, -10, 15, 0},
+    {54, 49, -103, 0}, {-5, -10, 15, 0}, {182, -104, -79, 0}, {-142, -147, 290, 0},
+    {-64, -69, 133, 0}, {-54, 192, -138, 0}, {80, 36, -116, 0}, {123, -163, 40, 0},
+    {123, 15, -138, 0}, {176, 40, -216, 0}, {54, 49, -103, 0}, {-64, -69, 133, 0},
+    {172, -187, 15, 0}, {-5, -10, 15, 0}, {54, -128, 74, 0}, {-5, -10, 15, 0},
+    {-7, -313, 320, 0}, {211, -29, -181, 0}, {-5, -10, 15, 0}, {-132, -7, 139, 0},
+    {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {-64, -69, 133, 0}, {182, -104, -79, 0}, {-5, -10, 15, 0}, {115, -33, -82, 0},
+    {301, -163, -138, 0}, {-158, -163, 321, 0}, {-5, -10, 15, 0}, {20, -59, 40, 0},
+    {182, -104, -79, 0}, {-64, -69, 133, 0}, {232, -128, -103, 0}, {-5, -10, 15, 0},
+    {60, -19, -41, 0}, {-5, -10, 15, 0}, {311, -79, -232, 0}, {252, -138, -113, 0},
+    {-83, 146, -63, 0}, {-133, -138, 272, 0}, {98, -239, 141, 0}, {113, -69, -44, 0},
+    {111, -145, 35, 0}, {-99, 177, -79, 0}, {138, 59, -197, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {-71, 75, -4, 0},
+    {113, -69, -44, 0}, {-5, -10, 15, 0}, {58, -5, -53, 0}, {-93, 240, -147, 0},
+    {-251, 230, 21, 0}, {291, -407, 116, 0}, {201, 289, -489, 0}, {123, -163, 40, 0},
+    {301, -163, -138, 0}, {-5, -10, 15, 0}, {-182, 167, 15, 0}, {182, -104, -79, 0},
+    {-64, -69, 133, 0}, {52, -39, -14, 0}, {-64, -69, 133, 0}, {41, 75, -116, 0},
+    {-77, 135, -57, 0}, {-230, -235, 465, 0}, {182, -104, -79, 0}, {-99, 177, -79, 0},
+    {54, 49, -103, 0}, {-64, -69, 133, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0},
+    {117, -300, 183, 0}, {16, 228, -245, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-142, 265, -122, 0}, {-5, -10, 15, 0}, {-261, 146, 114, 0}, {388, -207, -181, 0},
+    {-64, 108, -44, 0}, {2, -89, 87, 0}, {-5, -10, 15, 0}, {173, -446, 273, 0},
+    {-99, 177, -79, 0}, {-158, 296, -138, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {113, -69, -44, 0}, {-84, -3, 87, 0}, {20, -163, 143, 0},
+    {123, 15, -138, 0}, {-64, 108, -44, 0}, {-43, -152, 194, 0}, {-289, 61, 229, 0},
+    {89, 84, -172, 0}, {-188, 139, 49, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-24, 383, -359, 0}, {182, -104, -79, 0}, {113, 4, -118, 0}, {123, -163, 40, 0},
+    {-142, 265, -122, 0}, {-142, -147, 290, 0}, {87, -153, 65, 0}, {-158, 15, 143, 0},
+    {-64, -69, 133, 0}, {74, 39, -113, 0}, {-5, -10, 15, 0}, {30, -94, 64, 0},
+    {-40, -222, 262, 0}, {-99, 177, -79, 0}, {-142, 265, -122, 0}, {-64, -69, 133, 0},
+    {113, -69, -44, 0}, {-83, 146, -63, 0}, {113, -247, 133, 0}, {-217, 59, 158, 0},
+    {54, -128, 74, 0}, {19, 22, -41, 0}, {-83, -88, 171, 0}, {-5, -10, 15, 0},
+    {-118, -19, 137, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {16, -270, 253, 0},
+    {-5, -10, 15, 0}, {-47, 229, -182, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {151, -88, -63, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-12, -194, 206, 0}, {-99, -104, 203, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {182, -104, -79, 0}, {-64, -69, 133, 0}, {-5, 167, -162, 0},
+    {-5, -10, 15, 0}, {291, -247, -44, 0}, {182, -104, -79, 0}, {-158, 15, 143, 0},
+    {-24, -207, 231, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-123, 227, -103, 0},
+    {58, -78, 21, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {673, -349, -324, 0}, {-242, 108, 133, 0},
+    {197, 118, -315, 0}, {-5, -10, 15, 0}, {21, 89, -110, 0}, {-99, -104, 203, 0},
+    {-49, -54, 102, 0}, {-14, 60, -46, 0}, {-158, 15, 143, 0}, {-99, 177, -79, 0},
+    {-99, -104, 203, 0}, {-63, -38, 100, 0}, {89, 84, -172, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-540, -133, 674, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {270, -147, -122, 0}, {12, -79, 67, 0}, {-99, 177, -79, 0}, {303, -253, -50, 0},
+    {-5, -10, 15, 0}, {232, -306, 74, 0}, {319, -500, 182, 0}, {10, 372, -382, 0},
+    {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-64, -69, 133, 0}, {-5, -187, 192, 0},
+    {-145, 28, 117, 0}, {67, -85, 19, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {74, -316, 242, 0}, {-5, -10, 15, 0}, {89, 84, -172, 0}, {-99, 177, -79, 0},
+    {-64, -69, 133, 0}, {-5, -187, 192, 0}, {-217, 133, 84, 0}, {123, -163, 40, 0},
+    {301, -163, -138, 0}, {-64, -69, 133, 0}, {54, -128, 74, 0}, {-110, 158, -48, 0},
+    {-5, -10, 15, 0}, {-201, 206, -4, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {9, 60, -69, 0}, {-74, 25, 50, 0},
+    {-5, -10, 15, 0}, {-99, 177, -79, 0}, {-83, -88, 171, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-3, -54, 57, 0}, {-64, 108, -44, 0}, {89, 84, -172, 0},
+    {-5, -10, 15, 0}, {121, 93, -214, 0}, {-54, 15, 40, 0}, {-404, -409, 813, 0},
+    {-32, 222, -190, 0}, {-158, 15, 143, 0}, {-99, 177, -79, 0}, {-190, 126, 65, 0},
+    {-64, -69, 133, 0}, {30, 202, -232, 0}, {54, 49, -103, 0}, {113, -69, -44, 0},
+    {-118, 321, -202, 0}, {-5, -10, 15, 0}, {146, -271, 125, 0}, {-33, 189, -156, 0},
+    {-64, -69, 133, 0}, {245, -135, -110, 0}, {-87, -270, 357, 0}, {-123, 49, 74, 0},
+    {-99, 177, -79, 0}, {-5, -10, 15, 0}, {49, 127, -176, 0}, {-5, -10, 15, 0},
+    {-74, 25, 50, 0}, {176, -137, -39, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-252, -79, 331, 0}, {73, 68, -141, 0}, {-201, 206, -4, 0},
+    {-15, 10, 5, 0}, {73, -344, 271, 0}, {174, -329, 155, 0}, {-94, -20, 114, 0},
+    {-64, 108, -44, 0}, {-123, -128, 252, 0}, {-123, 49, 74, 0}, {-64, 108, -44, 0},
+    {-123, 49, 74, 0}, {-5, -10, 15, 0}, {72, 92, -164, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {45, -241, 196, 0}, {-64, -69, 133, 0}, {2, -107, 106, 0},
+    {182, -104, -79, 0}, {182, -104, -79, 0}, {-64, 108, -44, 0}, {-142, -147, 290, 0},
+    {-5, -10, 15, 0}, {-133, -138, 272, 0}, {-64, 108, -44, 0}, {113, -69, -44, 0},
+    {-5, -10, 15, 0}, {-99, -281, 380, 0}, {-5, -10, 15, 0}, {60, 55, -115, 0},
+    {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-64, 108, -44, 0}, {20, -163, 143, 0},
+    {-18, 24, -6, 0}, {-123, -128, 252, 0}, {-64, -69, 133, 0}, {327, -176, -151, 0},
+    {-64, -69, 133, 0}, {232, -128, -103, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {123, -163, 40, 0}, {-5, -10, 15, 0}, {232, -128, -103, 0}, {261, 152, -413, 0},
+    {-5, -10, 15, 0}, {-83, -266, 349, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0},
+    {-74, -257, 331, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-89, 157, -69, 0}, {-5, -10, 15, 0}, {-158, 15, 143, 0},
+    {-64, -69, 133, 0}, {183, 122, -305, 0}, {252, -316, 64, 0}, {-64, 108, -44, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {5, 74, -79, 0}, {-99, -104, 203, 0},
+    {564, -294, -269, 0}, {-83, 324, -241, 0}, {-142, -147, 290, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-201, -207, 408, 0}, {207, -257, 50, 0}, {47, 7, -54, 0},
+    {232, -128, -103, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-198, 141, 57, 0},
+    {-132, -7, 139, 0}, {79, 0, -79, 0}, {-5, -10, 15, 0}, {-99, 177, -79, 0},
+    {-64, -69, 133, 0}, {-5, -10, 15, 0}, {54, -128, 74, 0}, {151, 89, -241, 0},
+    {132, 127, -260, 0}, {54, 49, -103, 0}, {-123, -128, 252, 0}, {-5, -10, 15, 0},
+    {-347, 60, 287, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-306, -133, 439, 0},
+    {-5, -10, 15, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {73, -166, 93, 0},
+    {-24, -207, 231, 0}, {164, 78, -242, 0}, {135, 169, -304, 0}, {-99, -104, 203, 0},
+    {-5, -10, 15, 0}, {-99, -104, 203, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-99, -104, 203, 0}, {-324, 169, 155, 0}, {-64, -69, 133, 0}, {-402, 91, 311, 0},
+    {-5, -10, 15, 0}, {-158, 296, -138, 0}, {45, -241, 196, 0}, {-5, -10, 15, 0},
+    {113, -69, -44, 0}, {-99, -104, 203, 0}, {-123, -128, 252, 0}, {232, -128, -103, 0},
+    {-182, 167, 15, 0}, {-99, -104, 203, 0}, {-5, -10, 15, 0}, {222, 126, -348, 0},
+    {113, -69, -44, 0}, {232, -128, -103, 0}, {123, -163, 40, 0}, {123, 15, -138, 0},
+    {-30, -35, 64, 0}, {-54, 15, 40, 0}, {113, -69, -44, 0}, {89, -74, -15, 0},
+    {5, -104, 99, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-182, 167, 15, 0},
+    {-123, -128, 252, 0}, {-15, -94, 109, 0}, {-5, -10, 15, 0}, {-219, 274, -56, 0},
+    {-64, 108, -44, 0}, {54, -128, 74, 0}, {133, -27, -106, 0}, {-236, -241, 477, 0},
+    {-79, 64, 15, 0}, {-5, -10, 15, 0}, {117, -123, 6, 0}, {-123, 227, -103, 0},
+    {21, -127, 106, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {232, -128, -103, 0},
+    {20, 118, -138, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0}, {30, -79, 50, 0},
+    {182, -104, -79, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {125, 174, -299, 0},
+    {176, 40, -216, 0}, {-190, 126, 65, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {138, 59, -197, 0}, {-99, -104, 203, 0}, {187, -126, -61, 0}, {54, -128, 74, 0},
+    {-99, 0, 99, 0}, {374, -288, -86, 0}, {113, -69, -44, 0}, {-242, 108, 133, 0},
+    {-182, -10, 192, 0}, {-170, 76, 93, 0}, {182, -104, -79, 0}, {-67, -145, 212, 0},
+    {-73, -5, 78, 0}, {-171, -176, 347, 0}, {182, -104, -79, 0}, {64, -222, 158, 0},
+    {327, -176, -151, 0}, {-5, -10, 15, 0}, {-123, 227, -103, 0}, {-14, -123, 137, 0},
+    {113, -69, -44, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-64, 108, -44, 0},
+    {89, 84, -172, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {-32, -215, 247, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-64, -69, 133, 0}, {-158, 118, 40, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-123, 49, 74, 0}, {-5, -10, 15, 0}, {-192, 84, 109, 0}, {-5, -10, 15, 0},
+    {-158, 15, 143, 0}, {89, -117, 28, 0}, {64, -222, 158, 0}, {256, 0, -256, 0},
+    {-5, -10, 15, 0}, {-40, 59, -20, 0}, {-217, -45, 262, 0}, {-51, -56, 107, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {213, 87, -300, 0}, {314, -170, -145, 0}, {113, -69, -44, 0}, {79, -104, 25, 0},
+    {123, -163, 40, 0}, {-30, 39, -10, 0}, {54, 49, -103, 0}, {54, 49, -103, 0},
+    {54, -128, 74, 0}, {-40, -222, 262, 0}, {-123, 49, 74, 0}, {-5, -10, 15, 0},
+    {64, -222, 158, 0}, {-64, -69, 133, 0}, {-99, -104, 203, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {20, 118, -138, 0}, {-123, -128, 252, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {232, -128, -103, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-5, -10, 15, 0}, {-108, -113, 221, 0}, {-99, -104, 203, 0}, {211, -29, -181, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {118, -205, 88, 0}, {104, 185, -288, 0},
+    {-380, 177, 203, 0}, {-64, 108, -44, 0}, {-261, 324, -63, 0}, {-45, -123, 168, 0},
+    {20, 118, -138, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-40, -45, 84, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-230, 263, -33, 0},
+    {113, -69, -44, 0}, {-74, -153, 227, 0}, {-123, -128, 252, 0}, {-158, 118, 40, 0},
+    {-217, 133, 84, 0}, {-64, -69, 133, 0}, {54, -128, 74, 0}, {64, -45, -20, 0},
+    {-5, -10, 15, 0}, {-40, 237, -197, 0}, {-158, 15, 143, 0}, {-5, -10, 15, 0},
+    {54, -128, 74, 0}, {-64, 108, -44, 0}, {113, -69, -44, 0}, {273, 277, -551, 0},
+    {-315, 433, -118, 0}, {-64, -69, 133, 0}, {64, -222, 158, 0}, {161, 156, -317, 0},
+    {-64, 108, -44, 0}, {-99, 177, -79, 0}, {-5, -10, 15, 0}, {162, -94, -69, 0},
+    {-99, -104, 203, 0}, {-311, 143, 168, 0}, {-64, -69, 133, 0}, {-147, 26, 121, 0},
+    {94, 324, -418, 0}, {-32, -215, 247, 0}, {-171, -176, 347, 0}, {327, -176, -151, 0},
+    {-64, -69, 133, 0}, {-158, 296, -138, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {113, -69, -44, 0}, {-64, 108, -44, 0}, {-55, 117, -62, 0}, {113, -69, -44, 0},
+    {233, 11, -245, 0}, {276, -291, 15, 0}, {232, -128, -103, 0}, {-123, -128, 252, 0},
+    {-5, -10, 15, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-9, -41, 50, 0}, {-201, -29, 231, 0}, {5, -104, 99, 0}, {-171, -176, 347, 0},
+    {-99, -104, 203, 0}, {30, 98, -128, 0}, {-123, 227, -103, 0}, {-5, -10, 15, 0},
+    {54, 49, -103, 0}, {-123, 49, 74, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {194, -447, 253, 0}, {-171, -176, 347, 0}, {-5, -10, 15, 0},
+    {181, 254, -435, 0}, {-99, 177, -79, 0}, {113, -69, -44, 0}, {-192, 84, 109, 0},
+    {232, -128, -103, 0}, {-99, -104, 203, 0}, {163, 112, -275, 0}, {-158, 118, 40, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-89, 84, 5, 0}, {113, -69, -44, 0},
+    {-123, 49, 74, 0}, {-5, -10, 15, 0}, {-85, 65, 21, 0}, {-158, 15, 143, 0},
+    {363, -54, -310, 0}, {-414, 237, 177, 0}, {-99, -104, 203, 0}, {-64, -69, 133, 0},
+    {54, -128, 74, 0}, {133, -79, -54, 0}, {258, -141, -116, 0}, {-5, -10, 15, 0},
+    {113, -350, 237, 0}, {54, 49, -103, 0}, {64, 133, -197, 0}, {113, -69, -44, 0},
+    {-201, 383, -181, 0}, {163, 112, -275, 0}, {30, 25, -54, 0}, {-210, 399, -190, 0},
+    {64, -45, -20, 0}, {257, 56, -313, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-252, 202, 50, 0}, {-99, -104, 203, 0}, {82, -54, -29, 0}, {182, -104, -79, 0},
+    {-224, 428, -204, 0}, {44, -35, -10, 0}, {223, 171, -394, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {51, -235, 184, 0}, {350, -187, -162, 0}, {5, 74, -79, 0},
+    {142, -201, 59, 0}, {-64, -173, 237, 0}, {182, -104, -79, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {113, -69, -44, 0}, {301, -163, -138, 0},
+    {-5, -10, 15, 0}, {-201, 206, -4, 0}, {58, -5, -53, 0}, {-171, -176, 347, 0},
+    {-5, -10, 15, 0}, {-269, -96, 365, 0}, {113, -69, -44, 0}, {23, -217, 194, 0},
+    {-5, -10, 15, 0}, {172, -187, 15, 0}, {-5, -10, 15, 0}, {232, -128, -103, 0},
+    {-64, 108, -44, 0}, {-201, -29, 231, 0}, {214, -54, -160, 0}, {419, -311, -108, 0},
+    {-123, 49, 74, 0}, {113, -69, -44, 0}, {64, 133, -197, 0}, {-5, -10, 15, 0},
+    {11, 6, -16, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0}, {256, -281, 25, 0},
+    {79, 177, -256, 0}, {123, -163, 40, 0}, {-123, 49, 74, 0}, {-201, -29, 231, 0},
+    {-77, -82, 160, 0}, {44, -35, -10, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0},
+    {54, 49, -103, 0}, {-74, 25, 50, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {54, 49, -103, 0}, {182, -104, -79, 0}, {-68, 155, -87, 0}, {-158, -163, 321, 0},
+    {-158, 118, 40, 0}, {-208, 184, 24, 0}, {-207, -35, 242, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {370, -198, -172, 0}, {182, -104, -79, 0}, {350, -233, -117, 0}, {44, -35, -10, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {3, -26, 23, 0},
+    {54, -128, 74, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0},
+    {-5, -10, 15, 0}, {256, -281, 25, 0}, {-5, -10, 15, 0}, {232, -128, -103, 0},
+    {11, 136, -147, 0}, {-64, -69, 133, 0}, {-108, -113, 221, 0}, {-5, -10, 15, 0},
+    {-182, -10, 192, 0}, {113, -69, -44, 0}, {-64, 108, -44, 0}, {419, -311, -108, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {37, -8, -29, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0},
+    {-201, -29, 231, 0}, {-158, 15, 143, 0}, {113, -69, -44, 0}, {-210, 67, 143, 0},
+    {301, -163, -138, 0}, {-64, -69, 133, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-99, -104, 203, 0}, {76, 110, -186, 0}, {20, -59, 40, 0},
+    {-5, -10, 15, 0}, {-182, -10, 192, 0}, {-40, -45, 84, 0}, {-123, -306, 429, 0},
+    {-147, 38, 108, 0}, {-5, -10, 15, 0}, {-123, 49, 74, 0}, {-5, -10, 15, 0},
+    {268, -58, -210, 0}, {-40, 237, -197, 0}, {-5, -10, 15, 0}, {167, 178, -345, 0},
+    {-182, -10, 192, 0}, {232, -128, -103, 0}, {-158, 118, 40, 0}, {-65, 46, 19, 0},
+    {-64, 108, -44, 0}, {-5, -10, 15, 0}, {54, 49, -103, 0}, {-123, -128, 252, 0},
+    {26, -26, -1, 0}, {256, 0, -256, 0}, {-163, 202, -39, 0}, {-5, -10, 15, 0},
+    {327, -176, -151, 0}, {-5, -10, 15, 0}, {-171, -176, 347, 0}, {138, 59, -197, 0},
+    {123, -163, 40, 0}, {327, -176, -151, 0}, {182, -104, -79, 0}, {8, -16, 9, 0},
+    {270, -147, -122, 0}, {-5, -10, 15, 0}, {-339, 68, 271, 0}, {-142, -147, 290, 0},
+    {40, 4, -44, 0}, {-49, 77, -29, 0}, {-69, 29, 40, 0}, {-64, -69, 133, 0},
+    {182, -104, -79, 0}, {117, -123, 6, 0}, {-64, -69, 133, 0}, {-67, 32, 35, 0},
+    {268, -58, -210, 0}, {-224, 428, -204, 0}, {211, -207, -4, 0}, {-22, 64, -42, 0},
+    {30, 25, -54, 0}, {479, -252, -227, 0}, {-99, -104, 203, 0}, {268, -58, -210, 0},
+    {-59, 17, 42, 0}, {-5, -10, 15, 0}, {485, -344, -141, 0}, {-5, -10, 15, 0},
+    {-64, -69, 133, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {-133, 89, 44, 0},
+    {-5, -10, 15, 0}, {182, -104, -79, 0}, {-40, 59, -20, 0}, {-230, 263, -33, 0},
+    {-74, 37, 37, 0}, {148, -138, -10, 0}, {182, -104, -79, 0}, {-99, 177, -79, 0},
+    {-99, -104, 203, 0}, {-74, 25, 50, 0}, {-306, -133, 439, 0}, {-118, 112, 6, 0},
+    {-99, -104, 203, 0}, {-158, 118, 40, 0}, {-64, -69, 133, 0}, {117, -123, 6, 0},
+    {30, -257, 227, 0}, {122, -122, -1, 0}, {-142, -147, 290, 0}, {151, -88, -63, 0},
+    {27, 60, -87, 0}, {54, -128, 74, 0}, {270, -147, -122, 0}, {-261, 324, -63, 0},
+    {-24, -207, 231, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0}, {163, -254, 91, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-99, -104, 203, 0}, {64, -222, 158, 0},
+    {-64, 108, -44, 0}, {-5, -10, 15, 0}, {102, 97, -199, 0}, {-5, -10, 15, 0},
+    {20, -163, 143, 0}, {-24, 206, -181, 0}, {-123, -128, 252, 0}, {-142, -147, 290, 0},
+    {-5, -187, 192, 0}, {21, 81, -102, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-314, -188, 502, 0}, {-30, 80, -50, 0}, {-182, 167, 15, 0}, {64, 133, -197, 0},
+    {-99, -104, 203, 0}, {-74, 25, 50, 0}, {-64, 390, -325, 0}, {-324, -48, 372, 0},
+    {-5, -10, 15, 0}, {-123, -128, 252, 0}, {20, -163, 143, 0}, {-5, -10, 15, 0},
+    {-192, 84, 109, 0}, {-5, -10, 15, 0}, {-99, -104, 203, 0}, {123, -163, 40, 0},
+    {-224, 126, 98, 0}, {103, -153, 50, 0}, {-324, 450, -126, 0}, {-64, -69, 133, 0},
+    {-189, -17, 206, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {54, -128, 74, 0},
+    {158, -128, -30, 0}, {-414, 237, 177, 0}, {223, -95, -127, 0}, {-5, -10, 15, 0},
+    {138, 59, -197, 0}, {-5, -10, 15, 0}, {131, 39, -170, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {64, -45, -20, 0}, {54, -306, 252, 0}, {-99, 177, -79, 0},
+    {64, -45, -20, 0}, {-5, -10, 15, 0}, {-295, 158, 137, 0}, {-64, -69, 133, 0},
+    {-112, 26, 86, 0}, {-5, -10, 15, 0}, {-161, 68, 93, 0}, {233, -335, 102, 0},
+    {-123, -128, 252, 0}, {398, -300, -98, 0}, {-5, -10, 15, 0}, {-236, 40, 196, 0},
+    {54, -128, 74, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-142, -147, 290, 0}, {-40, -222, 262, 0}, {-142, -147, 290, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-192, 84, 109, 0}, {-158, 192, -34, 0}, {-201, 383, -181, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {89, 84, -172, 0}, {113, -69, -44, 0},
+    {-64, -69, 133, 0}, {262, 123, -385, 0}, {113, -69, -44, 0}, {-236, -241, 477, 0},
+    {-5, -10, 15, 0}, {352, -48, -304, 0}, {-108, 65, 43, 0}, {-64, 108, -44, 0},
+    {-192, 365, -172, 0}, {20, 118, -138, 0}, {-24, -207, 231, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-43, -8, 51, 0}, {1, 53, -53, 0}, {-5, -10, 15, 0},
+    {-40, 59, -20, 0}, {-99, 177, -79, 0}, {113, -69, -44, 0}, {-261, -88, 349, 0},
+    {-64, -69, 133, 0}, {-158, 296, -138, 0}, {113, -69, -44, 0}, {35, 87, -122, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-24, -207, 231, 0}, {-99, -104, 203, 0},
+    {-64, -69, 133, 0}, {113, -69, -44, 0}, {350, -187, -162, 0}, {-64, 108, -44, 0},
+    {-123, -128, 252, 0}, {-64, 108, -44, 0}, {-280, 127, 152, 0}, {-123, 227, -103, 0},
+    {54, -128, 74, 0}, {54, 49, -103, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0},
+    {-150, -34, 184, 0}, {-64, 108, -44, 0}, {55, -67, 12, 0}, {-64, -69, 133, 0},
+    {71, -77, 5, 0}, {-5, -10, 15, 0}, {-123, 227, -103, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-15, 66, -52, 0}, {92, -147, 55, 0}, {150, 1, -151, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {301, -163, -138, 0}, {20, 118, -138, 0},
+    {-99, 177, -79, 0}, {-180, 123, 57, 0}, {-142, -147, 290, 0}, {-5, -10, 15, 0},
+    {-276, -104, 380, 0}, {113, -247, 133, 0}, {-64, -69, 133, 0}, {176, 40, -216, 0},
+    {-5, -10, 15, 0}, {138, 59, -197, 0}, {-5, -10, 15, 0}, {64, -222, 158, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0}, {52, -49, -2, 0},
+    {-64, -69, 133, 0}, {-201, 206, -4, 0}, {182, -104, -79, 0}, {45, -87, 42, 0},
+    {113, -69, -44, 0}, {232, -128, -103, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {89, 84, -172, 0}, {89, -198, 109, 0}, {20, -163, 143, 0}, {-289, 61, 229, 0},
+    {-5, -10, 15, 0}, {-91, 59, 33, 0}, {-64, -69, 133, 0}, {-230, -235, 465, 0},
+    {-99, -104, 203, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {-49, 77, -29, 0}, {-5, -10, 15, 0}, {176, -241, 65, 0},
+    {73, 68, -141, 0}, {-182, -10, 192, 0}, {89, -20, -69, 0}, {-5, -10, 15, 0},
+    {232, -128, -103, 0}, {-182, 167, 15, 0}, {-60, 131, -71, 0}, {-64, 108, -44, 0},
+    {-5, 271, -266, 0}, {-123, 49, 74, 0}, {5, -104, 99, 0}, {-64, -69, 133, 0},
+    {-64, -69, 133, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-212, 168, 43, 0},
+    {-36, 6, 31, 0}, {-91, -96, 188, 0}, {-5, -10, 15, 0}, {-142, 265, -122, 0},
+    {-142, 87, 55, 0}, {-123, 227, -103, 0}, {-64, -69, 133, 0}, {-64, -69, 133, 0},
+    {-265, 228, 36, 0}, {54, 49, -103, 0}, {-123, -128, 252, 0}, {1, 53, -53, 0},
+    {-99, -104, 203, 0}, {60, -73, 13, 0}, {-123, -128, 252, 0}, {-158, 296, -138, 0},
+    {-5, -10, 15, 0}, {172, -10, -162, 0}, {104, 99, -204, 0}, {199, 123, -321, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {419, -311, -108, 0},
+    {-74, 25, 50, 0}, {-29, 2, 27, 0}, {-5, -10, 15, 0}, {370, -198, -172, 0},
+    {64, -400, 335, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0}, {-123, -128, 252, 0},
+    {-5, -10, 15, 0}, {113, -69, -44, 0}, {-26, -88, 114, 0}, {-171, -176, 347, 0},
+    {-5, -10, 15, 0}, {113, -69, -44, 0}, {-142, -147, 290, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-130, -135, 265, 0}, {-5, -10, 15, 0}, {174, -329, 155, 0},
+    {190, -313, 124, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {242, -45, -197, 0}, {-5, -10, 15, 0}, {-99, -104, 203, 0}, {-49, -54, 102, 0},
+    {54, -128, 74, 0}, {232, -128, -103, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {179, 164, -343, 0}, {-64, 108, -44, 0},
+    {233, -270, 36, 0}, {-123, 227, -103, 0}, {-5, -10, 15, 0}, {64, -45, -20, 0},
+    {54, 49, -103, 0}, {35, -139, 103, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {242, 133, -374, 0}, {148, -35, -113, 0}, {54, 49, -103, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-64, -69, 133, 0}, {232, -128, -103, 0}, {268, -235, -33, 0}, {113, -69, -44, 0},
+    {280, -204, -76, 0}, {-158, 296, -138, 0}, {-247, 474, -227, 0}, {-123, 49, 74, 0},
+    {-64, -69, 133, 0}, {282, 53, -334, 0}, {-178, -109, 287, 0}, {232, -128, -103, 0},
+    {-270, -24, 293, 0}, {-5, -10, 15, 0}, {-113, -45, 158, 0}, {-158, 296, -138, 0},
+    {113, -69, -44, 0}, {-135, 15, 120, 0}, {113, -69, -44, 0}, {123, 15, -138, 0},
+    {-5, 271, -266, 0}, {-5, -10, 15, 0}, {43, 38, -80, 0}, {-182, -10, 192, 0},
+    {-153, -158, 311, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-123, -128, 252, 0},
+    {20, -163, 143, 0}, {113, -69, -44, 0}, {-8, -117, 125, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {113, -69, -44, 0}, {123, 15, -138, 0}, {-158, 15, 143, 0},
+    {332, -132, -201, 0}, {182, -104, -79, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {6, -176, 170, 0}, {113, -69, -44, 0}, {54, -128, 74, 0}, {-5, -10, 15, 0},
+    {-15, 84, -69, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-190, 126, 65, 0},
+    {256, -281, 25, 0}, {-118, -19, 137, 0}, {35, 77, -112, 0}, {113, -69, -44, 0},
+    {-123, -128, 252, 0}, {-64, 108, -44, 0}, {-99, 177, -79, 0}, {-64, -69, 133, 0},
+    {-161, 68, 93, 0}, {217, -350, 133, 0}, {-147, -48, 194, 0}, {89, -20, -69, 0},
+    {-360, 522, -162, 0}, {-76, -81, 156, 0}, {-158, 15, 143, 0}, {-40, 59, -20, 0},
+    {233, -270, 36, 0}, {272, -166, -107, 0}, {54, -128, 74, 0}, {-70, 11, 59, 0},
+    {161, 156, -317, 0}, {-217, 133, 84, 0}, {-158, 296, -138, 0}, {-5, -10, 15, 0},
+    {89, 84, -172, 0}, {-5, -10, 15, 0}, {94, 146, -241, 0}, {-303, 305, -2, 0},
+    {-5, -10, 15, 0}, {113, -69, -44, 0}, {64, -45, -20, 0}, {61, -142, 81, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-142, -147, 290, 0},
+    {-158, 15, 143, 0}, {-210, 399, -190, 0}, {282, 230, -512, 0}, {-5, -10, 15, 0},
+    {54, 49, -103, 0}, {-49, -54, 102, 0}, {-59, 97, -39, 0}, {113, 108, -222, 0},
+    {-64, -69, 133, 0}, {-64, 108, -44, 0}, {-123, -128, 252, 0}, {-123, 227, -103, 0},
+    {-70, -35, 105, 0}, {-210, -215, 424, 0}, {-298, 576, -278, 0}, {-5, -10, 15, 0},
+    {-276, 251, 25, 0}, {-64, -69, 133, 0}, {113, -69, -44, 0}, {-64, 108, -44, 0},
+    {-192, 84, 109, 0}, {-64, -69, 133, 0}, {113, -69, -44, 0}, {113, -69, -44, 0},
+    {-182, 167, 15, 0}, {-5, -10, 15, 0}, {54, 49, -103, 0}, {-5, -10, 15, 0},
+    {99, -114, 15, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {301, -163, -138, 0},
+    {-5, -10, 15, 0}, {-73, -5, 78, 0}, {-5, -187, 192, 0}, {-217, 133, 84, 0},
+    {107, -224, 117, 0}, {-5, -10, 15, 0}, {54, -128, 74, 0}, {-36, -145, 182, 0},
+    {54, 49, -103, 0}, {54, -128, 74, 0}, {-5, -10, 15, 0}, {-40, -118, 158, 0},
+    {-158, -163, 321, 0}, {-53, -235, 288, 0}, {-64, 108, -44, 0}, {-133, 247, -113, 0},
+    {-5, -10, 15, 0}, {106, 122, -228, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-230, -58, 288, 0}, {-64, 108, -44, 0},
+    {-5, -10, 15, 0}, {20, 118, -138, 0}, {123, -163, 40, 0}, {-5, -10, 15, 0},
+    {325, -35, -291, 0}, {-73, 53, 21, 0}, {251, 68, -319, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {232, -128, -103, 0}, {301, -163, -138, 0}, {-5, -10, 15, 0},
+    {113, -247, 133, 0}, {-64, 108, -44, 0}, {251, 68, -319, 0}, {89, 84, -172, 0},
+    {-123, 49, 74, 0}, {-123, -128, 252, 0}, {-99, 177, -79, 0}, {-243, 353, -110, 0},
+    {-137, 143, -6, 0}, {89, -198, 109, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-24, 206, -181, 0}, {-5, -10, 15, 0}, {-24, -207, 231, 0}, {-99, -104, 203, 0},
+    {-99, 177, -79, 0}, {232, -128, -103, 0}, {-5, -10, 15, 0}, {-192, 365, -172, 0},
+    {41, 384, -425, 0}, {-158, 296, -138, 0}, {-99, -104, 203, 0}, {54, 49, -103, 0},
+    {-5, -10, 15, 0}, {-158, -163, 321, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {232, -128, -103, 0}, {-64, -69, 133, 0}, {-123, 49, 74, 0}, {51, 159, -210, 0},
+    {54, -306, 252, 0}, {-64, 108, -44, 0}, {73, -166, 93, 0}, {113, -69, -44, 0},
+    {86, -274, 188, 0}, {45, -241, 196, 0}, {-5, -10, 15, 0}, {-30, -138, 168, 0},
+    {-99, 177, -79, 0}, {54, -128, 74, 0}, {202, 233, -435, 0}, {-64, -69, 133, 0},
+    {54, -128, 74, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {113, -69, -44, 0},
+    {138, -222, 84, 0}, {64, -45, -20, 0}, {-212, 299, -88, 0}, {-201, -29, 231, 0},
+    {-93, 109, -16, 0}, {5, 74, -79, 0}, {-64, -69, 133, 0}, {123, 15, -138, 0},
+    {-64, 108, -44, 0}, {-5, -10, 15, 0}, {54, 49, -103, 0}, {-64, 108, -44, 0},
+    {-5, -10, 15, 0}, {113, -69, -44, 0}, {64, -222, 158, 0}, {-64, 108, -44, 0},
+    {-123, -128, 252, 0}, {51, -6, -45, 0}, {-324, 130, 194, 0}, {44, -373, 328, 0},
+    {235, -359, 124, 0}, {-5, -10, 15, 0}, {8, 284, -293, 0}, {270, -147, -122, 0},
+    {64, 133, -197, 0}, {57, 146, -204, 0}, {113, -247, 133, 0}, {-142, -147, 290, 0},
+    {113, -69, -44, 0}, {-113, -45, 158, 0}, {-64, -69, 133, 0}, {329, -266, -63, 0},
+    {182, -104, -79, 0}, {-64, 108, -44, 0}, {242, -45, -197, 0}, {182, -104, -79, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {145, -174, 29, 0}, {132, 127, -260, 0},
+    {-142, -147, 290, 0}, {54, 49, -103, 0}, {123, 15, -138, 0}, {132, 70, -203, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-24, -29, 53, 0}, {54, -128, 74, 0}, {105, -158, 53, 0}, {-236, 40, 196, 0},
+    {5, -104, 99, 0}, {-64, -69, 133, 0}, {-40, -45, 84, 0}, {350, -187, -162, 0},
+    {-99, -104, 203, 0}, {-133, 39, 94, 0}, {-5, -187, 192, 0}, {31, -8, -23, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {54, -128, 74, 0}, {-276, 74, 203, 0},
+    {-40, -222, 262, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {-54, -111, 165, 0},
+    {-5, -10, 15, 0}, {64, -45, -20, 0}, {-133, 247, -113, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-24, -207, 231, 0}, {-99, 177, -79, 0}, {-5, -10, 15, 0},
+    {221, -337, 116, 0}, {10, 91, -101, 0}, {-182, -10, 192, 0}, {-192, 84, 109, 0},
+    {-5, -10, 15, 0}, {-99, 177, -79, 0}, {-5, -10, 15, 0}, {-217, 237, -20, 0},
+    {-99, -281, 380, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {64, -45, -20, 0},
+    {-5, -10, 15, 0}, {-142, 30, 112, 0}, {-64, -69, 133, 0}, {-107, -73, 180, 0},
+    {-64, 108, -44, 0}, {54, 49, -103, 0}, {-182, 345, -162, 0}, {-64, -69, 133, 0},
+    {268, -58, -210, 0}, {151, 89, -241, 0}, {-182, -10, 192, 0}, {54, -128, 74, 0},
+    {113, -247, 133, 0}, {225, 16, -241, 0}, {71, -20, -52, 0}, {-5, -10, 15, 0},
+    {-335, 118, 217, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-142, 87, 55, 0},
+    {-158, 15, 143, 0}, {-5, -10, 15, 0}, {-5, 167, -162, 0}, {-5, -10, 15, 0},
+    {233, 77, -310, 0}, {-5, -10, 15, 0}, {57, 146, -204, 0}, {64, -45, -20, 0},
+    {232, -128, -103, 0}, {182, -104, -79, 0}, {-5, -10, 15, 0}, {-190, 126, 65, 0},
+    {-224, -229, 453, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-64, 108, -44, 0},
+    {-5, -10, 15, 0}, {-252, 483, -232, 0}, {113, -69, -44, 0}, {16, -53, 36, 0},
+    {113, -69, -44, 0}, {145, 75, -220, 0}, {301, -163, -138, 0}, {-45, 44, 2, 0},
+    {113, -69, -44, 0}, {-171, 145, 26, 0}, {-5, -10, 15, 0}, {123, -163, 40, 0},
+    {-64, -69, 133, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-5, -10, 15, 0}, {54, 49, -103, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-59, -7, 65, 0}, {-64, 108, -44, 0}, {17, 12, -30, 0}, {-5, -10, 15, 0},
+    {-64, -69, 133, 0}, {-5, -10, 15, 0}, {20, -163, 143, 0}, {182, -104, -79, 0},
+    {96, 246, -342, 0}, {-158, -163, 321, 0}, {113, -69, -44, 0}, {-217, 237, -20, 0},
+    {123, -163, 40, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-24, -207, 231, 0},
+    {47, 7, -54, 0}, {79, 177, -256, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {54, 49, -103, 0}, {-158, 15, 143, 0}, {-99, 177, -79, 0}, {182, -104, -79, 0},
+    {-5, -10, 15, 0}, {-74, 25, 50, 0}, {-64, -69, 133, 0}, {34, -62, 27, 0},
+    {276, -291, 15, 0}, {-142, 87, 55, 0}, {-99, 177, -79, 0}, {-5, -10, 15, 0},
+    {-64, -69, 133, 0}, {89, 84, -172, 0}, {-64, 108, -44, 0}, {-201, -29, 231, 0},
+    {-74, -257, 331, 0}, {54, -128, 74, 0}, {80, 206, -285, 0}, {113, -69, -44, 0},
+    {301, -163, -138, 0}, {99, 64, -162, 0}, {-217, 237, -20, 0}, {-142, 265, -122, 0},
+    {-74, -257, 331, 0}, {-5, -10, 15, 0}, {-73, -65, 138, 0}, {-99, -104, 203, 0},
+    {-5, -10, 15, 0}, {6, 41, -47, 0}, {9, 35, -44, 0}, {-5, -10, 15, 0},
+    {270, -325, 55, 0}, {-5, -10, 15, 0}, {-201, 206, -4, 0}, {-64, 108, -44, 0},
+    {-78, -23, 101, 0}, {-5, -187, 192, 0}, {-5, -10, 15, 0}, {207, -257, 50, 0},
+    {300, 428, -728, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0}, {-123, -128, 252, 0},
+    {325, -504, 178, 0}, {-265, 228, 36, 0}, {-5, -10, 15, 0}, {-192, 365, -172, 0},
+    {-5, -10, 15, 0}, {182, -104, -79, 0}, {113, -69, -44, 0}, {-99, -104, 203, 0},
+    {-5, -10, 15, 0}, {370, -198, -172, 0}, {113, -69, -44, 0}, {30, -79, 50, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {104, 230, -334, 0}, {-99, 177, -79, 0},
+    {118, -168, 50, 0}, {-40, -45, 84, 0}, {-148, 557, -409, 0}, {42, -62, 20, 0},
+    {-123, 49, 74, 0}, {-99, -104, 203, 0}, {-5, -10, 15, 0}, {-87, 510, -422, 0},
+    {-79, 211, -132, 0}, {113, -69, -44, 0}, {363, -54, -310, 0}, {94, 146, -241, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-74, -257, 331, 0},
+    {268, -58, -210, 0}, {-5, -10, 15, 0}, {-40, 59, -20, 0}, {-182, -10, 192, 0},
+    {54, -128, 74, 0}, {-5, -10, 15, 0}, {-154, 168, -14, 0}, {113, -69, -44, 0},
+    {20, -163, 143, 0}, {-182, 167, 15, 0}, {-318, 615, -298, 0}, {-158, 15, 143, 0},
+    {-5, -10, 15, 0}, {64, 133, -197, 0}, {2, 192, -195, 0}, {-201, 206, -4, 0},
+    {20, 118, -138, 0}, {-99, -104, 203, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-217, 310, -93, 0}, {-5, -10, 15, 0}, {-158, -163, 321, 0}, {170, 209, -379, 0},
+    {113, -69, -44, 0}, {123, 15, -138, 0}, {-5, -10, 15, 0}, {-217, 59, 158, 0},
+    {-99, -104, 203, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0}, {-274, 116, 158, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {123, 15, -138, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {182, -104, -79, 0},
+    {-43, 9, 34, 0}, {-64, -69, 133, 0}, {570, -209, -361, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {123, -163, 40, 0}, {-123, -128, 252, 0},
+    {-5, -10, 15, 0}, {20, 118, -138, 0}, {-5, -10, 15, 0}, {85, -98, 13, 0},
+    {233, -270, 36, 0}, {-182, -187, 370, 0}, {-182, 167, 15, 0}, {-5, -10, 15, 0},
+    {-40, -45, 84, 0}, {-5, 167, -162, 0}, {-64, 108, -44, 0}, {71, -20, -52, 0},
+    {-81, -160, 241, 0}, {-40, -45, 84, 0}, {325, -316, -10, 0}, {96, 246, -342, 0},
+    {275, -85, -190, 0}, {-123, -128, 252, 0}, {-339, 68, 271, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {123, 15, -138, 0}, {-5, -10, 15, 0}, {-142, -147, 290, 0},
+    {-64, 108, -44, 0}, {233, -270, 36, 0}, {68, -156, 88, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-147, 169, -23, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {55, 32, -86, 0},
+    {35, 87, -122, 0}, {-64, 108, -44, 0}, {20, -163, 143, 0}, {70, 18, -88, 0},
+    {-142, -147, 290, 0}, {55, 20, -75, 0}, {-5, -10, 15, 0}, {-30, -138, 168, 0},
+    {-158, 296, -138, 0}, {-49, 77, -29, 0}, {-5, -10, 15, 0}, {66, 204, -269, 0},
+    {-64, -69, 133, 0}, {-27, -55, 82, 0}, {-99, 177, -79, 0}, {-182, -10, 192, 0},
+    {-350, -74, 424, 0}, {-210, -215, 424, 0}, {-206, 71, 135, 0}, {140, 313, -453, 0},
+    {-99, 177, -79, 0}, {113, -69, -44, 0}, {-210, -392, 602, 0}, {-5, -10, 15, 0},
+    {-102, 110, -8, 0}, {-5, -10, 15, 0}, {-217, 237, -20, 0}, {291, -69, -222, 0},
+    {54, 49, -103, 0}, {64, -45, -20, 0}, {-16, -21, 38, 0}, {386, -294, -92, 0},
+    {-289, 204, 86, 0}, {-123, 49, 74, 0}, {54, -128, 74, 0}, {20, -163, 143, 0},
+    {-142, 87, 55, 0}, {-217, 133, 84, 0}, {33, -207, 173, 0}, {113, -69, -44, 0},
+    {-123, -128, 252, 0}, {-5, -10, 15, 0}, {104, 230, -334, 0}, {123, -163, 40, 0},
+    {-5, -10, 15, 0}, {245, -135, -110, 0}, {-192, 84, 109, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-236, 171, 65, 0}, {-64, -69, 133, 0}, {-210, -215, 424, 0},
+    {123, -163, 40, 0}, {-5, -10, 15, 0}, {64, 133, -197, 0}, {113, -69, -44, 0},
+    {-99, -104, 203, 0}, {-125, -485, 609, 0}, {-5, -10, 15, 0}, {-236, -241, 477, 0},
+    {-5, -10, 15, 0}, {320, 34, -353, 0}, {-64, -69, 133, 0}, {-64, 108, -44, 0},
+    {113, -69, -44, 0}, {197, -163, -34, 0}, {262, -232, -30, 0}, {182, -104, -79, 0},
+    {26, 83, -109, 0}, {-116, 429, -313, 0}, {-64, 108, -44, 0}, {-3, -225, 228, 0},
+    {-5, -10, 15, 0}, {75, -50, -25, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-182, -187, 370, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {291, -69, -222, 0}, {-192, 365, -172, 0},
+    {279, -480, 202, 0}, {-40, 59, -20, 0}, {256, 0, -256, 0}, {113, -69, -44, 0},
+    {-99, 177, -79, 0}, {113, -69, -44, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-99, -104, 203, 0}, {-142, 30, 112, 0}, {194, -67, -128, 0}, {-40, -45, 84, 0},
+    {174, -217, 43, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {-53, -235, 288, 0}, {123, -163, 40, 0}, {-123, -128, 252, 0},
+    {565, -207, -359, 0}, {-33, -85, 118, 0}, {327, -176, -151, 0}, {182, -104, -79, 0},
+    {207, -257, 50, 0}, {-171, 322, -151, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-89, -198, 286, 0}, {92, 208, -300, 0}, {-5, -10, 15, 0},
+    {-74, 25, 50, 0}, {182, -104, -79, 0}, {539, -141, -398, 0}, {-5, -10, 15, 0},
+    {211, -29, -181, 0}, {-158, 118, 40, 0}, {-182, 345, -162, 0}, {-123, -128, 252, 0},
+    {33, -29, -4, 0}, {226, -126, -101, 0}, {54, -55, 1, 0}, {-345, -69, 415, 0},
+    {54, 49, -103, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0}, {-261, 324, -63, 0},
+    {-142, 265, -122, 0}, {-158, 15, 143, 0}, {-210, -215, 424, 0}, {94, -266, 171, 0},
+    {-5, -10, 15, 0}, {-123, 49, 74, 0}, {-5, -10, 15, 0}, {217, -173, -44, 0},
+    {-24, -76, 100, 0}, {-123, 49, 74, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {54, -128, 74, 0}, {-74, 25, 50, 0}, {-99, 177, -79, 0}, {113, -69, -44, 0},
+    {223, -241, 19, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {182, -104, -79, 0},
+    {-305, 118, 187, 0}, {10, 91, -101, 0}, {-5, -10, 15, 0}, {89, -94, 5, 0},
+    {282, 53, -334, 0}, {-5, -10, 15, 0}, {-99, 177, -79, 0}, {-64, -69, 133, 0},
+    {-64, -69, 133, 0}, {-64, -69, 133, 0}, {-64, 108, -44, 0}, {-158, 15, 143, 0},
+    {172, -187, 15, 0}, {-64, -69, 133, 0}, {113, -69, -44, 0}, {182, -104, -79, 0},
+    {-148, 25, 123, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {-5, 167, -162, 0}, {-158, 118, 40, 0}, {-5, -10, 15, 0},
+    {113, -69, -44, 0}, {-99, -104, 203, 0}, {182, -104, -79, 0}, {-5, -10, 15, 0},
+    {15, 99, -113, 0}, {-5, -10, 15, 0}, {211, -207, -4, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {20, 15, -34, 0}, {-64, 108, -44, 0},
+    {64, -222, 158, 0}, {-311, 143, 168, 0}, {-295, 112, 183, 0}, {-5, 345, -340, 0},
+    {133, -257, 123, 0}, {-74, 25, 50, 0}, {-217, 133, 84, 0}, {-64, 108, -44, 0},
+    {-5, -10, 15, 0}, {182, -104, -79, 0}, {-59, -7, 65, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {182, -104, -79, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-98, -20, 118, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {113, -69, -44, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0},
+    {74, -286, 212, 0}, {54, -128, 74, 0}, {-14, -123, 137, 0}, {54, -128, 74, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {-15, 66, -52, 0}, {-182, -187, 370, 0}, {113, -69, -44, 0}, {64, -222, 158, 0},
+    {89, -198, 109, 0}, {-158, 15, 143, 0}, {-99, 177, -79, 0}, {-14, 55, -41, 0},
+    {-5, -10, 15, 0}, {-192, 84, 109, 0}, {-236, 171, 65, 0}, {-236, 40, 196, 0},
+    {-99, 74, 25, 0}, {433, -229, -204, 0}, {-87, 11, 76, 0}, {-5, -10, 15, 0},
+    {-24, 206, -181, 0}, {123, 15, -138, 0}, {-5, -10, 15, 0}, {192, -427, 234, 0},
+    {-55, 90, -35, 0}, {-99, -104, 203, 0}, {-422, -249, 671, 0}, {-370, 365, 5, 0},
+    {123, 15, -138, 0}, {-158, 118, 40, 0}, {-99, -104, 203, 0}, {-5, -10, 15, 0},
+    {345, -96, -249, 0}, {89, -198, 109, 0}, {-64, 108, -44, 0}, {123, 15, -138, 0},
+    {64, 133, -197, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-158, 118, 40, 0}, {-14, -300, 314, 0}, {54, -128, 74, 0}, {123, 15, -138, 0},
+    {-73, 53, 21, 0}, {-161, 51, 110, 0}, {82, -54, -29, 0}, {20, 118, -138, 0},
+    {182, -104, -79, 0}, {44, -35, -10, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-99, 177, -79, 0}, {-236, 171, 65, 0}, {-5, -10, 15, 0}, {138, 59, -197, 0},
+    {65, -352, 287, 0}, {-64, -69, 133, 0}, {-158, 118, 40, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-369, -374, 743, 0},
+    {-122, -240, 363, 0}, {54, 49, -103, 0}, {14, -48, 34, 0}, {113, 108, -222, 0},
+    {123, -163, 40, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-5, -10, 15, 0}, {30, 202, -232, 0}, {232, -410, 178, 0}, {-99, 0, 99, 0},
+    {-123, -128, 252, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-158, 296, -138, 0},
+    {-142, 265, -122, 0}, {-5, -10, 15, 0}, {54, 49, -103, 0}, {125, -235, 111, 0},
+    {54, 49, -103, 0}, {-64, -69, 133, 0}, {-99, -104, 203, 0}, {-5, -10, 15, 0},
+    {157, -143, -14, 0}, {-171, -176, 347, 0}, {-14, 112, -98, 0}, {-64, 108, -44, 0},
+    {-64, 108, -44, 0}, {-5, -10, 15, 0}, {182, -104, -79, 0}, {-5, -10, 15, 0},
+    {113, -69, -44, 0}, {-64, -69, 133, 0}, {-64, -69, 133, 0}, {-123, 227, -103, 0},
+    {-48, 51, -3, 0}, {-30, -35, 64, 0}, {-64, 108, -44, 0}, {-5, -187, 192, 0},
+    {-5, -10, 15, 0}, {-64, 108, -44, 0}, {79, -104, 25, 0}, {-5, -10, 15, 0},
+    {-64, -69, 133, 0}, {-83, -88, 171, 0}, {-217, -222, 439, 0}, {-182, 167, 15, 0},
+    {-123, 49, 74, 0}, {-158, 15, 143, 0}, {-15, 244, -229, 0}, {20, -163, 143, 0},
+    {-252, 202, 50, 0}, {-158, 296, -138, 0}, {-99, -104, 203, 0}, {-40, -45, 84, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-24, 28, -4, 0}, {-5, -10, 15, 0},
+    {145, 222, -367, 0}, {-5, -10, 15, 0}, {55, 69, -123, 0}, {-420, 231, 189, 0},
+    {-123, 227, -103, 0}, {182, -104, -79, 0}, {-64, -69, 133, 0}, {409, -128, -281, 0},
+    {96, 69, -165, 0}, {-99, 74, 25, 0}, {-210, 222, -12, 0}, {232, -128, -103, 0},
+    {113, -69, -44, 0}, {-5, -10, 15, 0}, {179, -262, 83, 0}, {-230, -413, 643, 0},
+    {-40, -45, 84, 0}, {-5, -10, 15, 0}, {-192, 84, 109, 0}, {-5, -10, 15, 0},
+    {242, -222, -20, 0}, {-84, -3, 87, 0}, {123, 15, -138, 0}, {291, -247, -44, 0},
+    {-5, -10, 15, 0}, {-99, -104, 203, 0}, {252, -316, 64, 0}, {-64, -69, 133, 0},
+    {54, -128, 74, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {12, -79, 67, 0},
+    {-5, -10, 15, 0}, {-142, -147, 290, 0}, {-182, 167, 15, 0}, {162, 188, -350, 0},
+    {-171, -176, 347, 0}, {-8, 54, -45, 0}, {-99, 177, -79, 0}, {136, -47, -89, 0},
+    {-5, -10, 15, 0}, {-142, 265, -122, 0}, {332, 400, -732, 0}, {-74, 25, 50, 0},
+    {-64, 108, -44, 0}, {115, -388, 273, 0}, {54, -128, 74, 0}, {-136, 179, -43, 0},
+    {-5, -10, 15, 0}, {41, -141, 100, 0}, {-5, -187, 192, 0}, {128, -25, -103, 0},
+    {131, 250, -381, 0}, {-5, -10, 15, 0}, {-276, 355, -79, 0}, {-158, 15, 143, 0},
+    {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-64, 108, -44, 0}, {579, -265, -314, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {113, -69, -44, 0}, {-323, 293, 30, 0},
+    {-102, -33, 135, 0}, {-64, -69, 133, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-182, -10, 192, 0}, {-123, -128, 252, 0}, {54, -55, 1, 0},
+    {-182, 167, 15, 0}, {123, -163, 40, 0}, {-252, 25, 227, 0}, {-123, 227, -103, 0},
+    {123, -163, 40, 0}, {44, 126, -170, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-46, 250, -204, 0}, {-261, 324, -63, 0},
+    {151, -88, -63, 0}, {113, -69, -44, 0}, {-123, 49, 74, 0}, {-64, -69, 133, 0},
+    {-502, 290, 212, 0}, {54, -128, 74, 0}, {232, -128, -103, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-123, -128, 252, 0}, {-5, -291, 296, 0}, {-24, 206, -181, 0},
+    {37, -289, 252, 0}, {172, -187, 15, 0}, {-64, -69, 133, 0}, {20, -59, 40, 0},
+    {-22, 305, -283, 0}, {-5, -10, 15, 0}, {-99, 177, -79, 0}, {-5, -10, 15, 0},
+    {30, 202, -232, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {-265, 51, 214, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-56, -134, 190, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {-64, -247, 311, 0}, {-99, 177, -79, 0}, {-40, -45, 84, 0},
+    {-363, 246, 116, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-49, -8, 57, 0},
+    {-24, 206, -181, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {123, 15, -138, 0}, {-201, -207, 408, 0}, {-224, -229, 453, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {294, -300, 6, 0}, {149, 110, -259, 0}, {-142, 265, -122, 0},
+    {-142, 265, -122, 0}, {-36, -323, 359, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {-330, 358, -29, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {232, -483, 252, 0},
+    {-261, -266, 526, 0}, {20, -59, 40, 0}, {-5, -10, 15, 0}, {20, -163, 143, 0},
+    {-40, -45, 84, 0}, {54, -128, 74, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {172, -187, 15, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {-98, 23, 75, 0},
+    {184, 145, -328, 0}, {-236, 171, 65, 0}, {-242, -69, 311, 0}, {-5, -10, 15, 0},
+    {54, 49, -103, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {73, -166, 93, 0},
+    {-5, -10, 15, 0}, {67, -34, -33, 0}, {-5, -10, 15, 0}, {-401, 250, 151, 0},
+    {327, -176, -151, 0}, {-64, 108, -44, 0}, {172, -187, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {-64, -69, 133, 0}, {-158, -163, 321, 0}, {-55, 117, -62, 0}, {-24, -207, 231, 0},
+    {113, -69, -44, 0}, {399, -52, -348, 0}, {127, -39, -88, 0}, {-182, 345, -162, 0},
+    {-123, 227, -103, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-123, 49, 74, 0},
+    {30, -79, 50, 0}, {182, 74, -256, 0}, {-5, -10, 15, 0}, {-53, -235, 288, 0},
+    {30, 25, -54, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-159, -34, 193, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-99, 177, -79, 0}, {232, -128, -103, 0},
+    {-64, -69, 133, 0}, {-5, -10, 15, 0}, {-182, -10, 192, 0}, {-5, -10, 15, 0},
+    {-64, -69, 133, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {-192, -198, 390, 0},
+    {505, -176, -328, 0}, {-40, 59, -20, 0}, {-5, -10, 15, 0}, {-182, 522, -340, 0},
+    {-158, 118, 40, 0}, {113, -69, -44, 0}, {-64, -69, 133, 0}, {232, -128, -103, 0},
+    {30, -257, 227, 0}, {-5, -10, 15, 0}, {-524, 262, 263, 0}, {138, -222, 84, 0},
+    {270, -147, -122, 0}, {-147, 169, -23, 0}, {-5, -10, 15, 0}, {-179, 114, 65, 0},
+    {-252, 202, 50, 0}, {-5, -10, 15, 0}, {-171, -176, 347, 0}, {-5, -10, 15, 0},
+    {81, 44, -126, 0}, {-123, 227, -103, 0}, {-5, -10, 15, 0}, {-123, 227, -103, 0},
+    {-99, 177, -79, 0}, {31, -117, 86, 0}, {-5, -10, 15, 0}, {64, -222, 158, 0},
+    {-89, 261, -172, 0}, {-10, 51, -40, 0}, {-5, -10, 15, 0}, {547, -145, -402, 0},
+    {-5, -10, 15, 0}, {-50, 49, 1, 0}, {20, 118, -138, 0}, {-5, -10, 15, 0},
+    {123, 15, -138, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-142, -147, 290, 0},
+    {45, 29, -73, 0}, {291, -69, -222, 0}, {54, 49, -103, 0}, {-64, 108, -44, 0},
+    {249, -254, 5, 0}, {91, -105, 14, 0}, {-5, -187, 192, 0}, {-158, -163, 321, 0},
+    {-5, -10, 15, 0}, {149, -58, -90, 0}, {-158, 118, 40, 0}, {151, -266, 114, 0},
+    {291, 108, -399, 0}, {-5, -10, 15, 0}, {256, 0, -256, 0}, {-30, -212, 242, 0},
+    {123, 15, -138, 0}, {20, 15, -34, 0}, {113, -69, -44, 0}, {20, -163, 143, 0},
+    {-5, -10, 15, 0}, {-123, 49, 74, 0}, {-158, 15, 143, 0}, {-192, 84, 109, 0},
+    {89, 84, -172, 0}, {-64, 108, -44, 0}, {-192, -198, 390, 0}, {113, -69, -44, 0},
+    {-302, 172, 130, 0}, {-64, -69, 133, 0}, {-64, -69, 133, 0}, {-261, 146, 114, 0},
+    {-64, 108, -44, 0}, {-5, -10, 15, 0}, {-123, 49, 74, 0}, {-108, 18, 90, 0},
+    {20, 118, -138, 0}, {-5, -10, 15, 0}, {24, 19, -42, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-158, 15, 143, 0}, {291, -247, -44, 0}, {488, -257, -232, 0},
+    {123, -163, 40, 0}, {-171, -176, 347, 0}, {182, -104, -79, 0}, {-613, 327, 286, 0},
+    {-99, -104, 203, 0}, {-5, -10, 15, 0}, {-99, -104, 203, 0}, {-123, 49, 74, 0},
+    {-123, 49, 74, 0}, {388, -207, -181, 0}, {-5, -10, 15, 0}, {197, -340, 143, 0},
+    {-118, -19, 137, 0}, {-158, 15, 143, 0}, {-64, -69, 133, 0}, {-64, 108, -44, 0},
+    {45, 171, -216, 0}, {-221, 186, 34, 0}, {-5, -10, 15, 0}, {20, -163, 143, 0},
+    {123, -163, 40, 0}, {-5, -10, 15, 0}, {311, -79, -232, 0}, {113, -69, -44, 0},
+    {-53, -58, 111, 0}, {242, -222, -20, 0}, {-30, 39, -10, 0}, {113, -69, -44, 0},
+    {-5, -10, 15, 0}, {301, -163, -138, 0}, {-5, -10, 15, 0}, {-142, 265, -122, 0},
+    {148, -138, -10, 0}, {-5, -10, 15, 0}, {30, 25, -54, 0}, {-5, -10, 15, 0},
+    {-64, -69, 133, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-99, -104, 203, 0},
+    {-220, 169, 51, 0}, {-436, 393, 43, 0}, {-5, -10, 15, 0}, {-324, 628, -304, 0},
+    {-236, 40, 196, 0}, {174, 130, -304, 0}, {-99, 177, -79, 0}, {113, -69, -44, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {182, -104, -79, 0}, {197, -340, 143, 0}, {113, -69, -44, 0},
+    {130, -48, -82, 0}, {113, -69, -44, 0}, {498, -261, -236, 0}, {-64, 108, -44, 0},
+    {-64, -69, 133, 0}, {207, -79, -128, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {-182, 167, 15, 0}, {-5, -10, 15, 0}, {-39, -30, 69, 0}, {20, -163, 143, 0},
+    {-201, -29, 231, 0}, {-5, -10, 15, 0}, {310, -64, -246, 0}, {134, -209, 75, 0},
+    {113, -69, -44, 0}, {-56, 63, -6, 0}, {-64, -69, 133, 0}, {-123, 49, 74, 0},
+    {-123, 49, 74, 0}, {172, 167, -340, 0}, {162, -375, 213, 0}, {-123, -128, 252, 0},
+    {20, -163, 143, 0}, {-49, 77, -29, 0}, {-90, 25, 65, 0}, {113, -69, -44, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {214, 10, -224, 0}, {38, -63, 24, 0},
+    {-61, -19, 80, 0}, {-133, -35, 168, 0}, {113, -247, 133, 0}, {-64, 108, -44, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-24, -207, 231, 0}, {293, -33, -259, 0},
+    {468, -247, -222, 0}, {-64, -69, 133, 0}, {182, -104, -79, 0}, {211, -207, -4, 0},
+    {-64, 108, -44, 0}, {117, -19, -98, 0}, {123, -163, 40, 0}, {4, -1, -3, 0},
+    {64, -45, -20, 0}, {-64, -69, 133, 0}, {-64, 108, -44, 0}, {-217, 237, -20, 0},
+    {-5, -10, 15, 0}, {176, -241, 65, 0}, {-40, 59, -20, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-55, -60, 115, 0}, {37, 123, -160, 0},
+    {350, -187, -162, 0}, {270, 30, -300, 0}, {-5, -10, 15, 0}, {54, 49, -103, 0},
+    {-5, -10, 15, 0}, {-99, 177, -79, 0}, {-99, 177, -79, 0}, {79, -104, 25, 0},
+    {123, -163, 40, 0}, {-217, -45, 262, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {86, 16, -102, 0}, {-217, 59, 158, 0}, {-14, -123, 137, 0},
+    {-83, 60, 22, 0}, {370, -198, -172, 0}, {-64, -69, 133, 0}, {-24, -207, 231, 0},
+    {64, -222, 158, 0}, {-5, -10, 15, 0}, {64, -45, -20, 0}, {20, 118, -138, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {315, 59, -374, 0},
+    {335, 36, -371, 0}, {-5, -10, 15, 0}, {78, -51, -26, 0}, {-261, -88, 349, 0},
+    {-5, -10, 15, 0}, {-205, 163, 42, 0}, {-5, -10, 15, 0}, {182, -104, -79, 0},
+    {80, 102, -181, 0}, {-24, -207, 231, 0}, {25, -71, 45, 0}, {113, -69, -44, 0},
+    {-5, -10, 15, 0}, {-118, 158, -41, 0}, {323, 300, -623, 0}, {-5, -10, 15, 0},
+    {-158, -163, 321, 0}, {-123, 227, -103, 0}, {138, -222, 84, 0}, {54, -128, 74, 0},
+    {79, 177, -256, 0}, {-273, 525, -253, 0}, {-380, 177, 203, 0}, {301, -163, -138, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-64, -69, 133, 0}, {-64, 108, -44, 0},
+    {125, 70, -195, 0}, {172, -187, 15, 0}, {-61, -66, 127, 0}, {174, -329, 155, 0},
+    {-406, 380, 26, 0}, {-5, -10, 15, 0}, {-217, 237, -20, 0}, {209, -117, -92, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-306, 414, -108, 0},
+    {150, -176, 26, 0}, {-247, 474, -227, 0}, {-158, 296, -138, 0}, {-151, 152, -1, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-99, -104, 203, 0},
+    {-5, -10, 15, 0}, {25, -231, 206, 0}, {-84, 109, -25, 0}, {-123, 49, 74, 0},
+    {20, -163, 143, 0}, {-58, -63, 121, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-5, -10, 15, 0}, {-209, 255, -46, 0}, {-5, -10, 15, 0}, {181, 220, -401, 0},
+    {-64, -69, 133, 0}, {-265, 11, 253, 0}, {-252, 202, 50, 0}, {-5, -10, 15, 0},
+    {-64, -69, 133, 0}, {-5, -10, 15, 0}, {148, -420, 272, 0}, {-5, -10, 15, 0},
+    {-230, -235, 465, 0}, {148, 132, -280, 0}, {-5, 167, -162, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {123, -163, 40, 0}, {-261, 501, -241, 0}, {-172, 74, 99, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {256, -281, 25, 0},
+    {-64, 108, -44, 0}, {-171, 322, -151, 0}, {-5, -10, 15, 0}, {217, -173, -44, 0},
+    {-5, -10, 15, 0}, {-123, 227, -103, 0}, {-123, 49, 74, 0}, {-158, 15, 143, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {268, -58, -210, 0},
+    {-118, -300, 418, 0}, {114, -93, -21, 0}, {270, -147, -122, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {92, 30, -122, 0}, {-18, 16, 2, 0}, {30, -79, 50, 0},
+    {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-64, -69, 133, 0}, {54, 49, -103, 0}, {-64, 108, -44, 0}, {117, -300, 183, 0},
+    {113, -69, -44, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0},
+    {5, -104, 99, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {1, -78, 78, 0}, {-5, -10, 15, 0}, {-217, 237, -20, 0},
+    {113, -350, 237, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {172, -10, -162, 0}, {-158, -163, 321, 0},
+    {301, -163, -138, 0}, {-5, -10, 15, 0}, {301, -163, -138, 0}, {64, 133, -197, 0},
+    {404, -215, -190, 0}, {329, -266, -63, 0}, {-5, -10, 15, 0}, {87, 42, -129, 0},
+    {327, -176, -151, 0}, {54, 49, -103, 0}, {54, -128, 74, 0}, {-64, 108, -44, 0},
+    {113, -69, -44, 0}, {-5, -10, 15, 0}, {-123, 49, 74, 0}, {-5, -10, 15, 0},
+    {-123, 227, -103, 0}, {123, -163, 40, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {533, -190, -342, 0}, {8, 181, -189, 0}, {-5, -10, 15, 0}, {54, -128, 74, 0},
+    {102, -224, 122, 0}, {-99, -104, 203, 0}, {-99, 177, -79, 0}, {-217, -222, 439, 0},
+    {-5, -10, 15, 0}, {516, -323, -194, 0}, {-5, -10, 15, 0}, {232, -128, -103, 0},
+    {-64, 108, -44, 0}, {163, 233, -396, 0}, {-5, -10, 15, 0}, {-315, 34, 281, 0},
+    {-217, 59, 158, 0}, {-158, 15, 143, 0}, {-5, -10, 15, 0}, {-133, -35, 168, 0},
+    {54, 49, -103, 0}, {182, -104, -79, 0}, {-242, -69, 311, 0}, {-5, -10, 15, 0},
+    {1, -78, 78, 0}, {233, 77, -310, 0}, {113, -69, -44, 0}, {-217, 59, 158, 0},
+    {-64, 108, -44, 0}, {172, -10, -162, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {-224, -229, 453, 0}, {404, -215, -190, 0}, {-59, 241, -182, 0}, {-140, -72, 212, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0},
+    {20, 118, -138, 0}, {80, 293, -373, 0}, {-30, 39, -10, 0}, {-11, -41, 52, 0},
+    {-182, -10, 192, 0}, {-64, 108, -44, 0}, {-342, 8, 334, 0}, {-30, 39, -10, 0},
+    {-5, -10, 15, 0}, {226, -178, -49, 0}, {113, -69, -44, 0}, {113, -69, -44, 0},
+    {172, -187, 15, 0}, {-12, 134, -122, 0}, {-5, -10, 15, 0}, {20, -163, 143, 0},
+    {327, -176, -151, 0}, {-158, 15, 143, 0}, {-118, -19, 137, 0}, {73, -344, 271, 0},
+    {123, 15, -138, 0}, {82, -54, -29, 0}, {-158, -163, 321, 0}, {-123, -128, 252, 0},
+    {-49, 255, -206, 0}, {146, 277, -423, 0}, {20, 118, -138, 0}, {113, -69, -44, 0},
+    {35, -147, 112, 0}, {-182, -187, 370, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {89, 84, -172, 0},
+    {35, 87, -122, 0}, {-14, -123, 137, 0}, {146, 277, -423, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-40, -118, 158, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0},
+    {-40, 59, -20, 0}, {-201, -29, 231, 0}, {54, -128, 74, 0}, {113, -69, -44, 0},
+    {-5, -10, 15, 0}, {-158, 15, 143, 0}, {-5, -10, 15, 0}, {30, 25, -54, 0},
+    {327, -176, -151, 0}, {113, -69, -44, 0}, {-49, -335, 383, 0}, {-24, -207, 231, 0},
+    {232, -128, -103, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0}, {174, -48, -126, 0},
+    {370, -198, -172, 0}, {140, 199, -339, 0}, {-5, -10, 15, 0}, {-128, 340, -212, 0},
+    {-64, -69, 133, 0}, {113, -69, -44, 0}, {172, -187, 15, 0}, {-64, 108, -44, 0},
+    {510, -497, -13, 0}, {-5, -10, 15, 0}, {45, 171, -216, 0}, {-52, -31, 83, 0},
+    {30, 25, -54, 0}, {-276, -104, 380, 0}, {54, 49, -103, 0}, {-158, 118, 40, 0},
+    {-64, -69, 133, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-158, 118, 40, 0},
+    {-5, -10, 15, 0}, {7, 116, -123, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, 108, -44, 0}, {54, 49, -103, 0},
+    {-5, -10, 15, 0}, {-24, 206, -181, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-217, 59, 158, 0}, {113, -69, -44, 0}, {374, -111, -263, 0},
+    {-129, 199, -70, 0}, {-40, -45, 84, 0}, {-64, 108, -44, 0}, {148, -138, -10, 0},
+    {-5, -10, 15, 0}, {-217, 59, 158, 0}, {-5, -10, 15, 0}, {79, -104, 25, 0},
+    {-224, -51, 275, 0}, {113, -69, -44, 0}, {54, 49, -103, 0}, {-224, -229, 453, 0},
+    {-24, -207, 231, 0}, {-5, -10, 15, 0}, {197, -163, -34, 0}, {-24, -207, 231, 0},
+    {-5, -10, 15, 0}, {182, -104, -79, 0}, {-158, -163, 321, 0}, {276, -10, -266, 0},
+    {-5, -10, 15, 0}, {140, 135, -276, 0}, {35, 87, -122, 0}, {-172, 251, -79, 0},
+    {-64, 108, -44, 0}, {64, -45, -20, 0}, {-5, -10, 15, 0}, {-99, 0, 99, 0},
+    {176, -241, 65, 0}, {82, -54, -29, 0}, {352, -48, -304, 0}, {89, -198, 109, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {54, -128, 74, 0},
+    {182, -104, -79, 0}, {-99, -104, 203, 0}, {370, -198, -172, 0}, {172, -10, -162, 0},
+    {-64, 108, -44, 0}, {73, -109, 36, 0}, {167, -119, -48, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-99, -104, 203, 0}, {-64, -69, 133, 0}, {172, -187, 15, 0},
+    {123, -163, 40, 0}, {51, -366, 315, 0}, {242, 133, -374, 0}, {-153, -158, 311, 0},
+    {-5, -10, 15, 0}, {113, -69, -44, 0}, {-142, 265, -122, 0}, {-5, -10, 15, 0},
+    {-64, -69, 133, 0}, {-99, -104, 203, 0}, {-5, -10, 15, 0}, {113, -69, -44, 0},
+    {-66, 62, 4, 0}, {-182, -10, 192, 0}, {45, 171, -216, 0}, {-139, 164, -25, 0},
+    {16, -270, 253, 0}, {-5, -10, 15, 0}, {-30, -316, 345, 0}, {123, -163, 40, 0},
+    {-96, 350, -254, 0}, {-64, -69, 133, 0}, {232, -128, -103, 0}, {-5, -10, 15, 0},
+    {-301, 404, -103, 0}, {-99, 74, 25, 0}, {79, -104, 25, 0}, {151, -266, 114, 0},
+    {-39, -22, 61, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-40, -45, 84, 0},
+    {278, -506, 228, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0},
+    {54, -128, 74, 0}, {-64, -69, 133, 0}, {-123, 227, -103, 0}, {151, -266, 114, 0},
+    {-5, -10, 15, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0}, {204, 135, -339, 0},
+    {-64, -69, 133, 0}, {232, 49, -281, 0}, {-43, 9, 34, 0}, {270, -147, -122, 0},
+    {-5, -10, 15, 0}, {-74, -79, 153, 0}, {-301, -128, 429, 0}, {-99, -104, 203, 0},
+    {776, -400, -375, 0}, {209, -117, -92, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-229, 1, 228, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {35, 30, -65, 0}, {113, -69, -44, 0}, {-261, 146, 114, 0}, {-252, 202, 50, 0},
+    {-64, -69, 133, 0}, {-5, -10, 15, 0}, {-99, 177, -79, 0}, {150, -87, -62, 0},
+    {182, -104, -79, 0}, {54, -128, 74, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-158, 15, 143, 0}, {-217, 133, 84, 0},
+    {-64, 108, -44, 0}, {45, 171, -216, 0}, {-99, 177, -79, 0}, {400, -330, -70, 0},
+    {-123, 227, -103, 0}, {115, 248, -363, 0}, {-5, -10, 15, 0}, {123, -163, 40, 0},
+    {-123, 49, 74, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0}, {-80, 139, -60, 0},
+    {-64, 286, -222, 0}, {79, -104, 25, 0}, {-3, -466, 469, 0}, {-5, -10, 15, 0},
+    {106, 153, -259, 0}, {656, -518, -138, 0}, {-123, -128, 252, 0}, {138, 237, -374, 0},
+    {-64, 108, -44, 0}, {113, -69, -44, 0}, {102, 274, -376, 0}, {-5, -10, 15, 0},
+    {54, -128, 74, 0}, {-3, -54, 57, 0}, {54, -128, 74, 0}, {-5, -10, 15, 0},
+    {146, -187, 40, 0}, {-182, 345, -162, 0}, {-5, -10, 15, 0}, {-40, -45, 84, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-40, 59, -20, 0}, {-217, 59, 158, 0},
+    {-142, 30, 112, 0}, {-64, 108, -44, 0}, {-142, 265, -122, 0}, {-64, 108, -44, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-64, 108, -44, 0}, {64, 59, -123, 0}, {-99, -104, 203, 0}, {-192, 84, 109, 0},
+    {-201, -29, 231, 0}, {-104, 11, 93, 0}, {113, -69, -44, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-293, 258, 35, 0}, {-64, 108, -44, 0}, {-5, -10, 15, 0},
+    {172, -187, 15, 0}, {-5, -10, 15, 0}, {232, -128, -103, 0}, {-64, 108, -44, 0},
+    {-61, -19, 80, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {182, -104, -79, 0},
+    {54, -128, 74, 0}, {113, -69, -44, 0}, {-123, -128, 252, 0}, {64, -45, -20, 0},
+    {268, -58, -210, 0}, {-26, 21, 5, 0}, {-5, -10, 15, 0}, {54, 49, -103, 0},
+    {-40, -222, 262, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {217, -173, -44, 0}, {-64, -69, 133, 0}, {-99, -104, 203, 0}, {-83, 146, -63, 0},
+    {-5, -10, 15, 0}, {54, -128, 74, 0}, {-142, 265, -122, 0}, {245, -453, 208, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-99, -104, 203, 0}, {-99, -104, 203, 0},
+    {5, -104, 99, 0}, {270, 265, -534, 0}, {-5, -10, 15, 0}, {-230, -58, 288, 0},
+    {197, 15, -212, 0}, {433, -229, -204, 0}, {211, -29, -181, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {113, -69, -44, 0}, {-123, -128, 252, 0}, {-64, -69, 133, 0},
+    {54, -128, 74, 0}, {-5, -10, 15, 0}, {-123, 49, 74, 0}, {182, -104, -79, 0},
+    {-182, -10, 192, 0}, {172, -187, 15, 0}, {54, -128, 74, 0}, {-58, -178, 236, 0},
+    {173, -174, 1, 0}, {-5, -10, 15, 0}, {-64, -69, 133, 0}, {-40, -45, 84, 0},
+    {-99, -104, 203, 0}, {-158, -163, 321, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-133, 143, -10, 0}, {-5, -10, 15, 0}, {232, -128, -103, 0}, {-123, 49, 74, 0},
+    {123, 15, -138, 0}, {172, -187, 15, 0}, {-158, 118, 40, 0}, {-64, 108, -44, 0},
+    {82, 228, -310, 0}, {54, -128, 74, 0}, {20, -163, 143, 0}, {-5, -10, 15, 0},
+    {-7, 14, -8, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-40, -45, 84, 0},
+    {-5, -10, 15, 0}, {158, 49, -207, 0}, {-64, -69, 133, 0}, {-5, -10, 15, 0},
+    {-311, 143, 168, 0}, {-5, -10, 15, 0}, {84, -219, 134, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {233, -270, 36, 0}, {44, -35, -10, 0}, {-14, 289, -275, 0},
+    {-192, 84, 109, 0}, {182, -104, -79, 0}, {-16, -21, 38, 0}, {211, -207, -4, 0},
+    {-12, 181, -169, 0}, {-83, 89, -6, 0}, {-28, -67, 96, 0}, {-83, -88, 171, 0},
+    {-168, 212, -44, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-158, 15, 143, 0},
+    {-5, -10, 15, 0}, {64, 133, -197, 0}, {-10, 85, -74, 0}, {-158, 15, 143, 0},
+    {-354, -78, 433, 0}, {54, 49, -103, 0}, {-5, -10, 15, 0}, {89, 84, -172, 0},
+    {-99, -104, 203, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {64, -222, 158, 0},
+    {30, 25, -54, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-30, -35, 64, 0}, {232, -128, -103, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-123, 49, 74, 0}, {262, 300, -562, 0}, {45, -241, 196, 0},
+    {-5, -10, 15, 0}, {-123, 227, -103, 0}, {-99, 177, -79, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {232, -128, -103, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {232, -128, -103, 0}, {-64, -69, 133, 0}, {-192, 84, 109, 0},
+    {-5, -10, 15, 0}, {-74, 25, 50, 0}, {-5, -10, 15, 0}, {-53, 85, -33, 0},
+    {-5, -10, 15, 0}, {-5, -10, 15, 0}, {-91, -274, 365, 0}, {64, -45, -20, 0},
+    {-335, 369, -34, 0}, {38, 65, -103, 0}, {-123, -128, 252, 0}, {302, 220, -522, 0},
+    {113, -69, -44, 0}, {-201, -29, 231, 0}, {113, -69, -44, 0}, {113, -69, -44, 0},
+    {113, -69, -44, 0}, {329, -266, -63, 0}, {-5, -10, 15, 0}, {131, 39, -170, 0},
+    {-249, 158, 91, 0}, {157, -26, -131, 0}, {-5, -10, 15, 0}, {270, -205, -65, 0},
+    {-5, -10, 15, 0}, {-123, -128, 252, 0}, {-149, 7, 142, 0}, {-101, -25, 126, 0},
+    {42, -103, 62, 0}, {12, -154, 142, 0}, {-5, -10, 15, 0}, {-5, -10, 15, 0},
+    {-5, -10, 15, 0}, {-99, -104, 203, 0}, {-64, -69, 133, 0}, {-20, 197, -177, 0},
+    {-5, -10, 15, 0}, {-64, -69, 133, 0}, {39, 315, -353, 0}, {235, -21, -213, 0},
+    {113, -69, -44, 0}, {40, -69, 30, 0}, {-99, -104, 203, 0}, {-5, -10, 15, 0},
+    {-64, -69, 133, 0}, {-182, -187, 370, 0}, {-5, -10, 15, 0}, {182, -104, -79, 0},
+    {54, -128, 74, 0}, {270, -147, -122, 0}, {-53, 263, -210, 0}, {20, 118, -138, 0},
+    {-5, -10, 15, 0}, {232, -128, -103, 0}, {54, -128, 74, 0}, {-99, -104, 203, 0},
+    {64, 289, -353, 0}, {-99, -104, 203, 0}, {123, -163, 40, 0}, {-5, -10, 15, 0},
+};